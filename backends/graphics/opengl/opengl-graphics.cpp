@@ -981,6 +981,11 @@ void OpenGLGraphicsManager::unlockScreen() {
 	_gameScreen->flagDirty();
 }
 
+void OpenGLGraphicsManager::unlockScreenRect(const Common::Rect &rect) {
+	assert(_gameScreen);
+	_gameScreen->flagDirty(rect);
+}
+
 void OpenGLGraphicsManager::setFocusRectangle(const Common::Rect& rect) {
 }
 
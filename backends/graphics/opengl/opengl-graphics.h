@@ -113,6 +113,7 @@ public:
 
 	Graphics::Surface *lockScreen() override;
 	void unlockScreen() override;
+	void unlockScreenRect(const Common::Rect &rect) override;
 
 	void setFocusRectangle(const Common::Rect& rect) override;
 	void clearFocusRectangle() override;
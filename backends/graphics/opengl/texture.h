@@ -108,6 +108,7 @@ public:
 	void fill(const Common::Rect &r, uint32 color);
 
 	void flagDirty() { _allDirty = true; }
+	void flagDirty(const Common::Rect &r) { addDirtyArea(r); }
 	virtual bool isDirty() const { return _allDirty || !_dirtyArea.isEmpty(); }
 
 	virtual uint getWidth() const = 0;
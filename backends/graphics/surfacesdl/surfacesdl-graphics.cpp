@@ -1778,6 +1778,23 @@ void SurfaceSdlGraphicsManager::unlockScreen() {
 	_graphicsMutex.unlock();
 }
 
+void SurfaceSdlGraphicsManager::unlockScreenRect(const Common::Rect &rect) {
+	assert(_transactionMode == kTransactionNone);
+
+	// paranoia check
+	assert(_screenIsLocked);
+	_screenIsLocked = false;
+
+	// Unlock the screen surface
+	SDL_UnlockSurface(_screen);
+
+	// Only update the locked part of the screen
+	addDirtyRect(rect.left, rect.top, rect.width(), rect.height(), false);
+
+	// Finally unlock the graphics mutex
+	_graphicsMutex.unlock();
+}
+
 void SurfaceSdlGraphicsManager::fillScreen(uint32 col) {
 	Graphics::Surface *screen = lockScreen();
 	if (screen)
@@ -180,6 +180,10 @@ void ModularGraphicsBackend::unlockScreen() {
 	_graphicsManager->unlockScreen();
 }
 
+void ModularGraphicsBackend::unlockScreenRect(const Common::Rect &rect) {
+	_graphicsManager->unlockScreenRect(rect);
+}
+
 void ModularGraphicsBackend::fillScreen(uint32 col) {
 	_graphicsManager->fillScreen(col);
 }
@@ -101,6 +101,7 @@ public:
 	void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) override final;
 	Graphics::Surface *lockScreen() override final;
 	void unlockScreen() override final;
+	void unlockScreenRect(const Common::Rect &rect) override final;
 	void fillScreen(uint32 col) override final;
 	void fillScreen(const Common::Rect &r, uint32 col) override final;
 	void updateScreen() override final;
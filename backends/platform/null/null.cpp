@@ -58,9 +58,9 @@ typedef void (*sighandler_t)(int);
 #include "backends/timer/default/default-timer.h"
 #include "backends/events/default/default-events.h"
 #include "backends/mixer/null/null-mixer.h"
-#include "backends/graphics/null/null-graphics.h"
 #include "gui/debugger.h"
 #endif
+#include "backends/graphics/null/null-graphics.h"
 
 /*
  * Include header files needed for the getFilesystemFactory() method.
@@ -158,6 +158,9 @@ void OSystem_NULL::initBackend() {
 	_mixerManager->init();
 
 	BaseBackend::initBackend();
+#else
+	// Codecs pick their default output format from the screen
+	_graphicsManager = new NullGraphicsManager();
 #endif
 }
 
@@ -68,6 +68,8 @@
 #endif
 #include "graphics/scalerplugin.h"
 
+#include "video/frame_cache.h"
+
 #include "backends/keymapper/action.h"
 #include "backends/keymapper/keymap.h"
 #include "backends/keymapper/keymapper.h"
@@ -844,6 +846,9 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 
 			DebugMan.removeAllDebugChannels();
 
+			// Free any video frames cached by the game
+			Video::FrameCache::destroy();
+
 #ifdef ENABLE_EVENTRECORDER
 			// Flush Event recorder file. The recorder does not get reinitialized for next game
 			// which is intentional. Only single game per session is allowed.
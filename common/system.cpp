@@ -36,6 +36,8 @@
 #include "common/textconsole.h"
 #include "common/text-to-speech.h"
 
+#include "graphics/surface.h"
+
 #include "backends/audiocd/default/default-audiocd.h"
 #include "backends/fs/fs-factory.h"
 #include "backends/timer/default/default-timer.h"
@@ -236,6 +238,19 @@ Common::Rect OSystem::getSafeOverlayArea(int16 *width, int16 *height) const {
 	return Common::Rect(w, h);
 }
 
+bool OSystem::lockScreenRect(const Common::Rect &rect, Graphics::Surface &surface) {
+	Graphics::Surface *screen = lockScreen();
+	if (!screen)
+		return false;
+
+	surface = screen->getSubArea(rect);
+	return true;
+}
+
+void OSystem::unlockScreenRect(const Common::Rect &rect) {
+	unlockScreen();
+}
+
 void OSystem::fatalError() {
 	quit();
 	exit(1);
@@ -1294,6 +1294,32 @@ public:
 	 */
 	virtual void unlockScreen() = 0;
 
+	/**
+	 * Lock a part of the active screen framebuffer and return a
+	 * Graphics::Surface representing it.
+	 *
+	 * This works like lockScreen(), but is meant for callers which only
+	 * update a known part of the screen, such as video players decoding
+	 * frames straight into the framebuffer instead of going through
+	 * copyRectToScreen(). Must be followed by a matching call to
+	 * unlockScreenRect() with the same rectangle.
+	 *
+	 * @param rect     The part of the screen to lock.
+	 * @param surface  Set to a surface covering the locked part of the screen.
+	 *                 Its pixels must *not* be freed by the client code.
+	 *
+	 * @return true if the screen was locked, false if an error occurred.
+	 *         In the latter case, unlockScreenRect() must not be called.
+	 */
+	virtual bool lockScreenRect(const Common::Rect &rect, Graphics::Surface &surface);
+
+	/**
+	 * Unlock the screen framebuffer after a call to lockScreenRect(). Backends
+	 * supporting it only update the given rectangle on the next updateScreen()
+	 * call.
+	 */
+	virtual void unlockScreenRect(const Common::Rect &rect);
+
 	/**
 	 * Fill the screen with the given color value.
 	 */
@@ -386,8 +386,10 @@ void init_draw_method() {
 
 	on_mainviewport_changed();
 	init_room_drawdata();
-	if (_G(gfxDriver)->UsesMemoryBackBuffer())
+	if (_G(gfxDriver)->UsesMemoryBackBuffer()) {
 		_G(gfxDriver)->GetMemoryBackBuffer()->Clear();
+		_G(gfxDriver)->MarkBackBufferDirty();
+	}
 }
 
 void dispose_draw_method() {
@@ -579,6 +581,7 @@ void on_roomviewport_changed(Viewport *view) {
 	// and only clear previous viewport location?
 	invalidate_screen();
 	_G(gfxDriver)->GetMemoryBackBuffer()->Clear();
+	_G(gfxDriver)->MarkBackBufferDirty();
 }
 
 void detect_roomviewport_overlaps(size_t z_index) {
@@ -2085,6 +2088,7 @@ void construct_game_scene(bool full_redraw) {
 			// black it out so we don't get cursor trails
 			// TODO: this is possible to do with dirty rects system now too (it can paint black rects outside of room viewport)
 			_G(gfxDriver)->GetMemoryBackBuffer()->Fill(0);
+			_G(gfxDriver)->MarkBackBufferDirty();
 		}
 	}
 
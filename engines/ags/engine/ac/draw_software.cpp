@@ -47,6 +47,7 @@
 
 #include "common/std/vector.h"
 #include "ags/engine/ac/draw_software.h"
+#include "ags/engine/gfx/graphics_driver.h"
 #include "ags/shared/gfx/bitmap.h"
 #include "ags/shared/util/scaling.h"
 #include "ags/globals.h"
@@ -306,6 +307,29 @@ void invalidate_rect_global(int x1, int y1, int x2, int y2) {
 		invalidate_rect_ds(rects, x1, y1, x2, y2, false);
 }
 
+// Tells graphics driver which parts of the screen are going to be repainted,
+// so that it could present only these. When scale is false, rects are only
+// offset by the viewport position; otherwise they are transformed from room to screen.
+static void mark_invalid_region_dirty(const DirtyRects &rects, bool scale) {
+	if (rects.NumDirtyRegions == WHOLESCREENDIRTY) {
+		_G(gfxDriver)->MarkBackBufferDirty(rects.Viewport);
+		return;
+	}
+
+	const std::vector<IRRow> &dirtyRow = rects.DirtyRows;
+	const int surf_height = rects.SurfaceSize.Height;
+	for (int i = 0, rowsInOne = 1; i < surf_height; i += rowsInOne, rowsInOne = 1) {
+		while ((i + rowsInOne < surf_height) && (memcmp(&dirtyRow[i], &dirtyRow[i + rowsInOne], sizeof(IRRow)) == 0))
+			rowsInOne++;
+
+		const IRRow &dirty_row = dirtyRow[i];
+		for (int k = 0; k < dirty_row.numSpans; k++) {
+			Rect r(dirty_row.span[k].x1, i, dirty_row.span[k].x2, i + rowsInOne - 1);
+			_G(gfxDriver)->MarkBackBufferDirty(scale ? rects.Room2Screen.ScaleRange(r) : OffsetRect(r, rects.Viewport.GetLT()));
+		}
+	}
+}
+
 // Note that this function is denied to perform any kind of scaling or other transformation
 // other than blitting with offset. This is mainly because destination could be a 32-bit virtual screen
 // while room background was 16-bit and Allegro lib does not support stretching between colour depths.
@@ -315,8 +339,10 @@ void update_invalid_region(Bitmap *ds, Bitmap *src, const DirtyRects &rects, boo
 	if (rects.NumDirtyRegions == 0)
 		return;
 
-	if (!no_transform)
+	if (!no_transform) {
 		ds->SetClip(rects.Viewport);
+		mark_invalid_region_dirty(rects, false);
+	}
 
 	const int src_x = rects.Room2Screen.X.GetSrcOffset();
 	const int src_y = rects.Room2Screen.Y.GetSrcOffset();
@@ -366,6 +392,7 @@ void update_invalid_region(Bitmap *ds, Bitmap *src, const DirtyRects &rects, boo
 
 void update_invalid_region(Bitmap *ds, color_t fill_color, const DirtyRects &rects) {
 	ds->SetClip(rects.Viewport);
+	mark_invalid_region_dirty(rects, true);
 
 	if (rects.NumDirtyRegions == WHOLESCREENDIRTY) {
 		ds->FillRect(rects.Viewport, fill_color);
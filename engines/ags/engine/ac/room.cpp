@@ -410,6 +410,36 @@ HError LoadRoomScript(RoomStruct *room, int newnum) {
 	return HError::None();
 }
 
+// Schedules sprites of the view loop for the background loading
+static void queue_view_loop_prefetch(int view, int loop) {
+	if (view < 0 || (size_t)view >= _GP(views).size())
+		return;
+	const ViewStruct &vs = _GP(views)[view];
+	if (loop < 0 || loop >= vs.numLoops)
+		return;
+	for (int i = 0; i < vs.loops[loop].numFrames; ++i)
+		_GP(spriteset).QueuePrefetch(vs.loops[loop].frames[i].pic);
+}
+
+// Schedules sprites which are likely to be displayed soon in the new room;
+// these are loaded in small portions between the game frames.
+static void queue_room_sprites_prefetch() {
+	_GP(spriteset).ClearPrefetch();
+	for (size_t i = 0; i < _G(croom)->numobj; ++i) {
+		const RoomObject &obj = _G(objs)[i];
+		if (!obj.on)
+			continue;
+		_GP(spriteset).QueuePrefetch(obj.num);
+		if (obj.cycling)
+			queue_view_loop_prefetch(obj.view, obj.loop);
+	}
+	for (int i = 0; i < _GP(game).numcharacters; ++i) {
+		const CharacterInfo &chi = _GP(game).chars[i];
+		if (chi.room == _G(displayed_room) && chi.on)
+			queue_view_loop_prefetch(chi.view, chi.loop);
+	}
+}
+
 static void reset_temp_room() {
 	_GP(troom) = RoomStatus();
 }
@@ -852,6 +882,7 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 		if (_G(objs)[cc].on == 2)
 			MergeObject(cc);
 	}
+	queue_room_sprites_prefetch();
 	_G(new_room_flags) = 0;
 	_GP(play).gscript_timer = -1; // avoid screw-ups with changing screens
 	_GP(play).player_on_region = 0;
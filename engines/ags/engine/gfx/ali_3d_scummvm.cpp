@@ -155,6 +155,7 @@ void ScummVMRendererGraphicsDriver::CreateVirtualScreen() {
 	_origVirtualScreen.reset(new Bitmap(vscreen_w, vscreen_h, _srcColorDepth));
 	virtualScreen = _origVirtualScreen.get();
 	_stageVirtualScreen = virtualScreen;
+	_fullDirty = true;
 
 
 	_lastTexPixels = nullptr;
@@ -277,6 +278,8 @@ void ScummVMRendererGraphicsDriver::InitSpriteBatch(size_t index, const SpriteBa
 	Rect viewport = desc.Viewport;
 	SpriteTransform transform = desc.Transform;
 	Bitmap *parent_surf = virtualScreen;
+	Point parent_offset;
+	const bool parent_on_screen = GetParentScreenOffset(desc, parent_offset);
 	if (desc.Parent != UINT32_MAX) {
 		const auto &parent = _spriteBatches[desc.Parent];
 		if (parent.Surface)
@@ -299,12 +302,15 @@ void ScummVMRendererGraphicsDriver::InitSpriteBatch(size_t index, const SpriteBa
 		batch.Surface = desc.Surface;
 		batch.Opaque = true;
 		batch.IsParentRegion = false;
+		batch.OnScreen = false;
 	}
 	// In case something was not initialized
 	else if (desc.Viewport.IsEmpty() || !virtualScreen) {
 		batch.Surface.reset();
 		batch.Opaque = false;
 		batch.IsParentRegion = false;
+		batch.OnScreen = parent_on_screen;
+		batch.ScreenOffset = parent_offset;
 	}
 	// Drawing directly on a viewport without transformation (other than offset):
 	// then make a subbitmap of the parent surface (virtualScreen or else).
@@ -319,6 +325,8 @@ void ScummVMRendererGraphicsDriver::InitSpriteBatch(size_t index, const SpriteBa
 		}
 		batch.Opaque = true;
 		batch.IsParentRegion = true;
+		batch.OnScreen = parent_on_screen;
+		batch.ScreenOffset = parent_offset + viewport.GetLT();
 		// Because we sub-bitmap to viewport, render offsets should account for that
 		transform.X -= viewport.Left;
 		transform.Y -= viewport.Top;
@@ -331,12 +339,24 @@ void ScummVMRendererGraphicsDriver::InitSpriteBatch(size_t index, const SpriteBa
 		}
 		batch.Opaque = false;
 		batch.IsParentRegion = false;
+		batch.OnScreen = false;
 	}
 
 	batch.Viewport = viewport;
 	batch.Transform = transform;
 }
 
+bool ScummVMRendererGraphicsDriver::GetParentScreenOffset(const SpriteBatchDesc &desc, Point &offset) const {
+	if ((desc.Parent != UINT32_MAX) && _spriteBatches[desc.Parent].Surface) {
+		const auto &parent = _spriteBatches[desc.Parent];
+		offset = parent.ScreenOffset;
+		return parent.OnScreen;
+	}
+	// no parent surface means drawing right on the virtual screen
+	offset = Point();
+	return true;
+}
+
 void ScummVMRendererGraphicsDriver::ResetAllBatches() {
 	// NOTE: we don't release batches themselves here, only sprite lists.
 	// This is because we cache batch surfaces, for performance reasons.
@@ -437,6 +457,9 @@ void ScummVMRendererGraphicsDriver::RenderToBackBuffer() {
 			// then blit our own surface to the parent's
 			if (surface && !batch.IsParentRegion) {
 				parent_surf->StretchBlt(surface, viewport, batch.Opaque ? kBitmap_Copy : kBitmap_Transparency);
+				Point parent_offset;
+				if (GetParentScreenOffset(batch_desc, parent_offset))
+					AddDirtyRect(OffsetRect(viewport, parent_offset));
 			}
 
 			// Back to the parent batch
@@ -452,6 +475,7 @@ void ScummVMRendererGraphicsDriver::RenderToBackBuffer() {
 
 	_stageVirtualScreen = virtualScreen;
 	_rendSpriteBatch = UINT32_MAX;
+	UpdateSpriteDirtyRects();
 	ClearDrawLists();
 }
 
@@ -465,17 +489,23 @@ size_t ScummVMRendererGraphicsDriver::RenderSpriteBatch(const ALSpriteBatch &bat
 				error("Unhandled attempt to draw null sprite");
 			// Stage surface could have been replaced by plugin
 			surface = _stageVirtualScreen;
+			// Plugin could have drawn anything anywhere
+			_fullDirty = true;
 			continue;
 		} else if (sprite.ddb == reinterpret_cast<ALSoftwareBitmap *>(DRAWENTRY_TINT)) {
 			// draw screen tint fx
 			set_trans_blender(_tint_red, _tint_green, _tint_blue, 0);
 			surface->LitBlendBlt(surface, 0, 0, 128);
+			_fullDirty = true;
 			continue;
 		}
 
 		ALSoftwareBitmap *bitmap = sprite.ddb;
 		int drawAtX = sprite.x + surf_offx;
 		int drawAtY = sprite.y + surf_offy;
+		if (batch.OnScreen && (bitmap->_alpha > 0))
+			_spriteRects.push_back(RectWH(drawAtX + batch.ScreenOffset.X, drawAtY + batch.ScreenOffset.Y,
+				bitmap->_bmp->GetWidth(), bitmap->_bmp->GetHeight()));
 
 		if (bitmap->_alpha == 0) {
 		} // fully transparent, do nothing
@@ -501,15 +531,15 @@ size_t ScummVMRendererGraphicsDriver::RenderSpriteBatch(const ALSpriteBatch &bat
 	return from;
 }
 
-void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bool mode) {
+void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bool mode, const Common::Rect &area) {
 	assert(src.w == _screen->w && src.h == _screen->h && src.pitch == _screen->pitch);
-	const uint32 *srcP = (const uint32 *)src.getPixels();
-	uint32 *destP = (uint32 *)_screen->getPixels();
 	uint32 pixel;
 	int x1 = 9999, y1 = 9999, x2 = -1, y2 = -1;
 
-	for (int y = 0; y < src.h; ++y) {
-		for (int x = 0; x < src.w; ++x, ++srcP, ++destP) {
+	for (int y = area.top; y < area.bottom; ++y) {
+		const uint32 *srcP = (const uint32 *)src.getBasePtr(area.left, y);
+		uint32 *destP = (uint32 *)_screen->getBasePtr(area.left, y);
+		for (int x = area.left; x < area.right; ++x, ++srcP, ++destP) {
 			if (!mode) {
 				pixel = (*srcP & 0xff00ff00) |
 					((*srcP & 0xff) << 16) |
@@ -586,15 +616,25 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 	if (renderMode != kRenderDirect && !_screen)
 		_screen = new Graphics::Screen();
 
+	// Present only the changed regions of the virtual screen, unless the whole
+	// frame has to be updated: the screen was replaced or modified in unknown way,
+	// the image is transformed, or a paletted image has to be converted.
+	if (_fullDirty || srcTransformed || _wasTransformed ||
+			(virtualScreen != _origVirtualScreen.get()) || (renderMode != _lastRenderMode) ||
+			((src.format.bytesPerPixel == 1) && (renderMode != kRenderDirect))) {
+		_dirtyRects.clear();
+		_dirtyRects.push_back(RectWH(0, 0, src.w, src.h));
+	}
+	_fullDirty = false;
+	_wasTransformed = srcTransformed != nullptr;
+	_lastRenderMode = renderMode;
+
 	switch (renderMode) {
 	case kRenderToABGR:
-		// ARGB to ABGR
-		copySurface(src, false);
-		break;
-
 	case kRenderToRGBA:
-		// ARGB to RGBA
-		copySurface(src, true);
+		// ARGB to ABGR or RGBA
+		for (const auto &rc : _dirtyRects)
+			copySurface(src, renderMode == kRenderToRGBA, Common::Rect(rc.Left, rc.Top, rc.Right + 1, rc.Bottom + 1));
 		break;
 
 	case kRenderOther: {
@@ -603,15 +643,18 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		Graphics::Surface srcCopy = src;
 		srcCopy.format.aLoss = 8;
 
-		_screen->blitFrom(srcCopy);
+		for (const auto &rc : _dirtyRects)
+			_screen->blitFrom(srcCopy, Common::Rect(rc.Left, rc.Top, rc.Right + 1, rc.Bottom + 1), Common::Point(rc.Left, rc.Top));
 		break;
 	}
 
 	case kRenderDirect:
 		// Blit the virtual surface directly to the screen
-		g_system->copyRectToScreen(src.getPixels(), src.pitch,
-			0, 0, src.w, src.h);
+		for (const auto &rc : _dirtyRects)
+			g_system->copyRectToScreen(src.getBasePtr(rc.Left, rc.Top), src.pitch,
+				rc.Left, rc.Top, rc.GetWidth(), rc.GetHeight());
 		g_system->updateScreen();
+		_dirtyRects.clear();
 		if (srcTransformed) {
 			srcTransformed->free();
 			delete srcTransformed;
@@ -621,6 +664,7 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 	default:
 		break;
 	}
+	_dirtyRects.clear();
 
 	if (srcTransformed) {
 		srcTransformed->free();
@@ -631,6 +675,51 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		_screen->update();
 }
 
+void ScummVMRendererGraphicsDriver::MarkBackBufferDirty(const Rect &rc) {
+	if (rc.IsEmpty())
+		_fullDirty = true;
+	else
+		AddDirtyRect(rc);
+}
+
+void ScummVMRendererGraphicsDriver::AddDirtyRect(const Rect &rc) {
+	if (_fullDirty || !virtualScreen)
+		return;
+	const Rect clip_rc = IntersectRects(rc, RectWH(virtualScreen->GetSize()));
+	if (clip_rc.IsEmpty())
+		return;
+	// Merge with the first overlapping rectangle, or skip if already covered
+	for (auto &dirty : _dirtyRects) {
+		if (IsRectInsideRect(dirty, clip_rc))
+			return;
+		if (AreRectsIntersecting(dirty, clip_rc)) {
+			dirty = SumRects(dirty, clip_rc);
+			return;
+		}
+	}
+	if (_dirtyRects.size() < MaxDirtyRects) {
+		_dirtyRects.push_back(clip_rc);
+		return;
+	}
+	// Too many separate regions, update their bounding box instead
+	Rect bounds = clip_rc;
+	for (const auto &dirty : _dirtyRects)
+		bounds = SumRects(bounds, dirty);
+	_dirtyRects.resize(1);
+	_dirtyRects[0] = bounds;
+}
+
+void ScummVMRendererGraphicsDriver::UpdateSpriteDirtyRects() {
+	// Sprites are redrawn on each frame, and the places which they have left
+	// have to be updated too; identical rectangles are merged by AddDirtyRect
+	for (const auto &rc : _spriteRects)
+		AddDirtyRect(rc);
+	for (const auto &rc : _prevSpriteRects)
+		AddDirtyRect(rc);
+	_prevSpriteRects.swap(_spriteRects);
+	_spriteRects.clear();
+}
+
 void ScummVMRendererGraphicsDriver::Render(int xoff, int yoff, GraphicFlip flip) {
 	RenderToBackBuffer();
 	Present(xoff, yoff, flip);
@@ -653,6 +742,7 @@ void ScummVMRendererGraphicsDriver::SetMemoryBackBuffer(Bitmap *backBuffer) {
 		virtualScreen = _origVirtualScreen.get();
 	}
 	_stageVirtualScreen = virtualScreen;
+	_fullDirty = true;
 
 	// Reset old virtual screen's subbitmaps;
 	// NOTE: this MUST NOT be called in the midst of the RenderSpriteBatches!
@@ -665,7 +755,9 @@ void ScummVMRendererGraphicsDriver::SetMemoryBackBuffer(Bitmap *backBuffer) {
 	}
 }
 
-Bitmap *ScummVMRendererGraphicsDriver::GetStageBackBuffer(bool /*mark_dirty*/) {
+Bitmap *ScummVMRendererGraphicsDriver::GetStageBackBuffer(bool mark_dirty) {
+	if (mark_dirty)
+		_fullDirty = true;
 	return _stageVirtualScreen;
 }
 
@@ -151,6 +151,10 @@ struct ALSpriteBatch {
 	bool IsParentRegion = false;
 	// Tells whether the surface is treated as opaque or transparent
 	bool Opaque = false;
+	// Whether the sprites of this batch end up drawn right on the virtual screen,
+	// and the offset of the batch's drawing surface on the virtual screen
+	bool OnScreen = false;
+	Point ScreenOffset;
 };
 typedef std::vector<ALSpriteBatch> ALSpriteBatches;
 
@@ -231,6 +235,7 @@ public:
 	void RenderSpritesAtScreenResolution(bool /*enabled*/) override {}
 	Bitmap *GetMemoryBackBuffer() override;
 	void SetMemoryBackBuffer(Bitmap *backBuffer) override;
+	void MarkBackBufferDirty(const Rect &rc) override;
 	Bitmap *GetStageBackBuffer(bool mark_dirty) override;
 	void SetStageBackBuffer(Bitmap *backBuffer) override;
 	bool GetStageMatrixes(RenderMatrixes & /*rm*/) override {
@@ -283,6 +288,21 @@ private:
 	// List of sprites to render
 	std::vector<ALDrawListEntry> _spriteList;
 
+	// Max number of separate dirty rectangles, after which they are merged into one
+	static const size_t MaxDirtyRects = 16;
+	// Regions of the virtual screen changed since the last Present
+	std::vector<Rect> _dirtyRects;
+	// Tells that the whole virtual screen must be presented
+	bool _fullDirty = true;
+	// Virtual screen rectangles of the sprites drawn in the last and previous frames;
+	// compared to find the regions which sprites have left or moved from
+	std::vector<Rect> _spriteRects;
+	std::vector<Rect> _prevSpriteRects;
+	// Tells if the last presented frame had offset or flip applied
+	bool _wasTransformed = false;
+	// Screen format conversion used for the last presented frame
+	int _lastRenderMode = -1;
+
 	void InitSpriteBatch(size_t index, const SpriteBatchDesc &desc) override;
 	void ResetAllBatches() override;
 
@@ -293,13 +313,19 @@ private:
 	void ReleaseDisplayMode();
 	// Renders single sprite batch on the precreated surface
 	size_t RenderSpriteBatch(const ALSpriteBatch &batch, size_t from, Shared::Bitmap *surface, int surf_offx, int surf_offy);
+	// Tells if the parent of the given batch draws on the virtual screen, and at which offset
+	bool GetParentScreenOffset(const SpriteBatchDesc &desc, Point &offset) const;
+	// Adds a changed region of the virtual screen, to be updated on the next Present
+	void AddDirtyRect(const Rect &rc);
+	// Adds dirty regions left by the sprites of the last rendered frame
+	void UpdateSpriteDirtyRects();
 
 	void highcolor_fade_in(Bitmap *vs, void(*draw_callback)(), int speed, int targetColourRed, int targetColourGreen, int targetColourBlue);
 	void highcolor_fade_out(Bitmap *vs, void(*draw_callback)(), int speed, int targetColourRed, int targetColourGreen, int targetColourBlue);
 	void __fade_from_range(PALETTE source, PALETTE dest, int speed, int from, int to);
 	void __fade_out_range(int speed, int from, int to, int targetColourRed, int targetColourGreen, int targetColourBlue);
-	// Copy raw screen bitmap pixels to the screen
-	void copySurface(const Graphics::Surface &src, bool mode);
+	// Copy raw screen bitmap pixels within the area to the screen
+	void copySurface(const Graphics::Surface &src, bool mode, const Common::Rect &area);
 	// Render bitmap on screen
 	void Present(int xoff = 0, int yoff = 0, Shared::GraphicFlip flip = Shared::kFlip_None);
 };
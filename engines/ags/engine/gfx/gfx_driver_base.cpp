@@ -174,6 +174,10 @@ void VideoMemoryGraphicsDriver::SetMemoryBackBuffer(Bitmap * /*backBuffer*/) {
 	// do nothing, video-memory drivers don't use main back buffer, only stage bitmaps they pass to plugins
 }
 
+void VideoMemoryGraphicsDriver::MarkBackBufferDirty(const Rect & /*rc*/) {
+	// do nothing, video-memory drivers redraw whole frame anyway
+}
+
 Bitmap *VideoMemoryGraphicsDriver::GetStageBackBuffer(bool mark_dirty) {
 	if (_rendSpriteBatch == UINT32_MAX)
 		return nullptr;
@@ -258,6 +258,7 @@ public:
 
 	Bitmap *GetMemoryBackBuffer() override;
 	void SetMemoryBackBuffer(Bitmap *backBuffer) override;
+	void MarkBackBufferDirty(const Rect &rc) override;
 	Bitmap *GetStageBackBuffer(bool mark_dirty) override;
 	void SetStageBackBuffer(Bitmap *backBuffer) override;
 	bool GetStageMatrixes(RenderMatrixes &rm) override;
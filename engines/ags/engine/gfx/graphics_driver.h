@@ -243,6 +243,11 @@ public:
 	// Passing NULL pointer will tell renderer to switch back to its original virtual screen.
 	// Note that only software renderer supports this.
 	virtual void SetMemoryBackBuffer(Shared::Bitmap *backBuffer) = 0;
+	// Tells that the given region of the memory backbuffer was modified directly,
+	// bypassing the sprite batches. Renderers which only present the changed parts
+	// of the screen must include this region in the next update.
+	// An empty rectangle means the whole backbuffer.
+	virtual void MarkBackBufferDirty(const Rect &rc = Rect()) = 0;
 	// Returns memory backbuffer for the current rendering stage (or base virtual screen if called outside of render pass).
 	// All renderers should support this.
 	virtual Shared::Bitmap *GetStageBackBuffer(bool mark_dirty = false) = 0;
@@ -464,8 +464,10 @@ void show_preload() {
 		Debug::Printf("Displaying preload image");
 		if (splashsc->GetColorDepth() == 8)
 			set_palette_range(temppal, 0, 255, 0);
-		if (_G(gfxDriver)->UsesMemoryBackBuffer())
+		if (_G(gfxDriver)->UsesMemoryBackBuffer()) {
 			_G(gfxDriver)->GetMemoryBackBuffer()->Clear();
+			_G(gfxDriver)->MarkBackBufferDirty();
+		}
 
 		const Rect &view = _GP(play).GetMainViewport();
 		Bitmap *tsc = BitmapHelper::CreateBitmapCopy(splashsc, _GP(game).GetColorDepth());
@@ -504,7 +506,9 @@ int engine_init_sprites() {
 
 	if (_GP(usetup).SpriteCacheSize > 0)
 		_GP(spriteset).SetMaxCacheSize(_GP(usetup).SpriteCacheSize * 1024);
-	Debug::Printf("Sprite cache set: %zu KB", _GP(spriteset).GetMaxCacheSize() / 1024);
+	_GP(spriteset).SetMaxPackedCacheSize(_GP(usetup).SpritePackedCacheSize * 1024);
+	Debug::Printf("Sprite cache set: %zu KB, compressed tier: %zu KB",
+		_GP(spriteset).GetMaxCacheSize() / 1024, _GP(spriteset).GetMaxPackedCacheSize() / 1024);
 	return 0;
 }
 
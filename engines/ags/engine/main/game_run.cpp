@@ -892,6 +892,10 @@ void UpdateGameOnce(bool checkControls, IDriverDependantBitmap *extraBitmap, int
 	if (_G(abort_engine))
 		return;
 
+	// Load a portion of the scheduled sprites before waiting for the next frame
+	if (_GP(spriteset).HasPendingPrefetch())
+		_GP(spriteset).ProcessPrefetch(2);
+
 	WaitForNextFrame();
 }
 
@@ -131,15 +131,17 @@ static bool play_video(Video::VideoDecoder *decoder, const char *name, int flags
 				}
 			}
 			if (do_break)
-				return true; // skip on key press
+				break; // skip on key press
 			if (run_service_mb_controls(mbut, mwheelz) && mbut >= kMouseNone && skip == VideoSkipKeyOrMouse)
-				return true; // skip on mouse click
+				break; // skip on mouse click
 		}
 	}
 
 	// Clear the screen after playback
-	if (_G(gfxDriver)->UsesMemoryBackBuffer())
+	if (_G(gfxDriver)->UsesMemoryBackBuffer()) {
 		_G(gfxDriver)->GetMemoryBackBuffer()->Clear();
+		_G(gfxDriver)->MarkBackBufferDirty();
+	}
 	render_to_screen();
 
 	invalidate_screen();
@@ -560,7 +560,10 @@ int ccInstance::Run(int32_t curpc) {
 	thisbase[0] = 0;
 	funcstart[0] = pc;
 	ccInstance *codeInst = runningInst;
-	ScriptOperation codeOp;
+	if (!codeInst->decoded_code)
+		codeInst->DecodeCode();
+	const ScriptCodeCache &decoded = *codeInst->decoded_code;
+	ScriptCodeOp rawOp; // for the code positions which could not be pre-decoded
 	FunctionCallStack func_callstack;
 #if DEBUG_CC_EXEC
 	const bool dump_opcodes = (ccGetOption(SCOPT_DEBUGRUN) != 0) ||
@@ -583,34 +586,30 @@ int ccInstance::Run(int32_t curpc) {
 		//
 		/* Read operation */
 		//=====================================================================
-		codeOp.Instruction.Code         = codeInst->code[pc];
-		codeOp.Instruction.InstanceId   = (codeOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
-		codeOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
+		const int32_t opIndex = (pc >= 0 && pc < codeInst->codesize) ? decoded.OpIndex[pc] : -1;
+		if (opIndex < 0) {
+			CC_ERROR_IF_RETCODE(pc < 0 || pc >= codeInst->codesize,
+								"program counter out of code range (%d; %d)", pc, codeInst->codesize);
 
-		CC_ERROR_IF_RETCODE((codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS),
-							"invalid instruction %d found in code stream", codeOp.Instruction.Code);
+			rawOp.Instruction.Code         = codeInst->code[pc];
+			rawOp.Instruction.InstanceId   = (rawOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
+			rawOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
 
-		codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
+			CC_ERROR_IF_RETCODE((rawOp.Instruction.Code < 0 || rawOp.Instruction.Code >= CC_NUM_SCCMDS),
+								"invalid instruction %d found in code stream", rawOp.Instruction.Code);
 
-		CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= codeInst->codesize,
-							"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
+			rawOp.ArgCount = (*g_commands)[rawOp.Instruction.Code].ArgCount;
+			rawOp.Length = rawOp.ArgCount + 1;
 
+			CC_ERROR_IF_RETCODE(pc + rawOp.ArgCount >= codeInst->codesize,
+								"unexpected end of code data (%d; %d)", pc + rawOp.ArgCount, codeInst->codesize);
 
-		// Read arguments; use switch as it proved to be faster than the loop
-
-		switch (codeOp.ArgCount) {
-		case 3:
-			codeOp.Args[2].SetInt32(static_cast<int32_t>(codeInst->code[pc + 3]));
-			/* fall-through */
-		case 2:
-			codeOp.Args[1].SetInt32(static_cast<int32_t>(codeInst->code[pc + 2]));
-			/* fall-through */
-		case 1:
-			codeOp.Args[0].SetInt32(static_cast<int32_t>(codeInst->code[pc + 1]));
-			break;
-		default:
-			break;
+			for (int i = 0; i < rawOp.ArgCount; ++i)
+				rawOp.Args[i].SetInt32(static_cast<int32_t>(codeInst->code[pc + 1 + i]));
+			rawOp.RuntimeFixup = (rawOp.ArgCount >= 2) && (codeInst->code_fixups[pc + 2] != FIXUP_NOFIXUP);
 		}
+		// Pre-decoded instructions have already been checked
+		const ScriptCodeOp &codeOp = (opIndex < 0) ? rawOp : decoded.Ops[opIndex];
 		//---------------------------------------------------------------------
 		/* End read operation */
 		//=====================================================================
@@ -692,9 +691,11 @@ int ccInstance::Run(int32_t curpc) {
 			// be only up to 4 bytes large;
 			// I guess that's an obsolete way to do WRITE, WRITEW and WRITEB
 			const auto arg_size = codeOp.Arg1i();
-			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
-			ASSERT_CC_ERROR();
-			const auto &arg_value = codeOp.Arg2();
+			RuntimeScriptValue arg_value = codeOp.Arg2();
+			if (codeOp.RuntimeFixup) {
+				FixupArgument(arg_value, codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
+				ASSERT_CC_ERROR();
+			}
 			switch (arg_size) {
 			case sizeof(char):
 				registers[SREG_MAR].WriteByte(arg_value.IValue);
@@ -729,10 +730,14 @@ int ccInstance::Run(int32_t curpc) {
 		}
 		case SCMD_LITTOREG: {
 			auto &reg1 = registers[codeOp.Arg1i()];
-			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
-			ASSERT_CC_ERROR();
-			const auto &arg_value = codeOp.Arg2();
-			reg1 = arg_value;
+			if (codeOp.RuntimeFixup) {
+				RuntimeScriptValue arg_value = codeOp.Arg2();
+				FixupArgument(arg_value, codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
+				ASSERT_CC_ERROR();
+				reg1 = arg_value;
+			} else {
+				reg1 = codeOp.Arg2();
+			}
 			break;
 		}
 		case SCMD_MEMREAD: {
@@ -1457,6 +1462,28 @@ int ccInstance::Run(int32_t curpc) {
 			if (loopIterationCheckDisabled == 0)
 				loopIterationCheckDisabled++;
 			break;
+		case SCMD_FUSED_LOADSPOFFS_MEMREAD: {
+			registers[SREG_MAR] = GetStackPtrOffsetRw(codeOp.Arg1i());
+			ASSERT_CC_ERROR();
+			registers[codeOp.FusedReg] = registers[SREG_MAR].ReadValue();
+			break;
+		}
+		case SCMD_FUSED_LOADSPOFFS_MEMWRITE: {
+			registers[SREG_MAR] = GetStackPtrOffsetRw(codeOp.Arg1i());
+			ASSERT_CC_ERROR();
+			registers[SREG_MAR].WriteValue(registers[codeOp.FusedReg]);
+			break;
+		}
+		case SCMD_FUSED_LITTOREG_MEMREAD: {
+			registers[SREG_MAR] = codeOp.Arg2();
+			registers[codeOp.FusedReg] = registers[SREG_MAR].ReadValue();
+			break;
+		}
+		case SCMD_FUSED_LITTOREG_MEMWRITE: {
+			registers[SREG_MAR] = codeOp.Arg2();
+			registers[SREG_MAR].WriteValue(registers[codeOp.FusedReg]);
+			break;
+		}
 		default:
 			cc_error("instruction %d is not implemented", codeOp.Instruction.Code);
 			return -1;
@@ -1464,7 +1491,7 @@ int ccInstance::Run(int32_t curpc) {
 		/* End perform operation */
 		//=====================================================================
 
-		pc += codeOp.ArgCount + 1;
+		pc += codeOp.Length;
 	}
 	return 0;
 }
@@ -1598,6 +1625,7 @@ bool ccInstance::_Create(PScript scri, const ccInstance *joined) {
 		globaldata = joined->globaldata;
 		code = joined->code;
 		codesize = joined->codesize;
+		decoded_code = joined->decoded_code;
 	} else {
 		// create own memory space
 		// NOTE: globalvars are created in CreateGlobalVars()
@@ -1725,6 +1753,7 @@ void ccInstance::Free() {
 	globalvars.reset();
 	globaldata = nullptr;
 	code = nullptr;
+	decoded_code.reset();
 	strings = nullptr;
 
 	delete[] stack;
@@ -1950,9 +1979,82 @@ bool ccInstance::ResolveImportFixups(const ccScript *scri) {
 		if (import->InstancePtr != nullptr && (code[fixup + 1] & INSTANCE_ID_REMOVEMASK) == SCMD_CALLEXT)
 			code[fixup + 1] = SCMD_CALLAS | (import->InstancePtr->loadedInstanceId << INSTANCE_ID_SHIFT);
 	}
+
+	// The code won't be modified anymore
+	DecodeCode();
 	return true;
 }
 
+void ccInstance::DecodeCode() {
+	decoded_code.reset(new ScriptCodeCache());
+	ScriptCodeCache &decoded = *decoded_code;
+	decoded.OpIndex.resize(codesize, -1);
+
+	// The byte-code is a plain sequence of instructions, each followed by
+	// its arguments. Decoding stops at the first invalid instruction; the
+	// executor reports the error if it ever gets there.
+	for (int32_t at = 0; at < codesize;) {
+		ScriptCodeOp op;
+		op.Instruction.Code = code[at];
+		op.Instruction.InstanceId = (op.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
+		op.Instruction.Code &= INSTANCE_ID_REMOVEMASK;
+		if (op.Instruction.Code < 0 || op.Instruction.Code >= CC_NUM_SCCMDS)
+			break;
+		op.ArgCount = (*g_commands)[op.Instruction.Code].ArgCount;
+		op.Length = op.ArgCount + 1;
+		if (at + op.ArgCount >= codesize)
+			break;
+
+		for (int i = 0; i < op.ArgCount; ++i)
+			op.Args[i].SetInt32(static_cast<int32_t>(code[at + 1 + i]));
+
+		// Literals which refer to the global data, strings or functions
+		// are resolved now, while stack and import references depend on
+		// the state at the time the instruction is run
+		if (op.Instruction.Code == SCMD_LITTOREG || op.Instruction.Code == SCMD_WRITELIT) {
+			const char fixup = code_fixups[at + 2];
+			if (fixup == FIXUP_GLOBALDATA || fixup == FIXUP_STRING || fixup == FIXUP_FUNCTION)
+				FixupArgument(op.Args[1], fixup, code[at + 2], stack, strings);
+			else
+				op.RuntimeFixup = (fixup != FIXUP_NOFIXUP);
+		}
+
+		decoded.OpIndex[at] = static_cast<int32_t>(decoded.Ops.size());
+		decoded.Ops.push_back(op);
+		at += op.Length;
+	}
+
+#if !DEBUG_CC_EXEC
+	// Fuse the instruction pairs used for reading and writing variables.
+	// The second instruction keeps its own entry, in case it's the target of
+	// a jump. Line numbers and loop checks only happen on instructions
+	// which are never fused, so the debugger hooks are not affected.
+	for (size_t i = 0; i + 1 < decoded.Ops.size(); ++i) {
+		ScriptCodeOp &op = decoded.Ops[i];
+		const ScriptCodeOp &next = decoded.Ops[i + 1];
+		const bool nextReads = (next.Instruction.Code == SCMD_MEMREAD);
+		if (!nextReads && next.Instruction.Code != SCMD_MEMWRITE)
+			continue;
+
+		if (op.Instruction.Code == SCMD_LOADSPOFFS) {
+			op.Instruction.Code = nextReads ? SCMD_FUSED_LOADSPOFFS_MEMREAD : SCMD_FUSED_LOADSPOFFS_MEMWRITE;
+		} else if (op.Instruction.Code == SCMD_LITTOREG && op.Arg1i() == SREG_MAR && !op.RuntimeFixup) {
+			op.Instruction.Code = nextReads ? SCMD_FUSED_LITTOREG_MEMREAD : SCMD_FUSED_LITTOREG_MEMWRITE;
+		} else {
+			continue;
+		}
+
+		op.FusedReg = next.Arg1i();
+		op.Length += next.Length;
+		decoded.FusedOps++;
+		++i; // the second instruction can't start another pair
+	}
+#endif
+
+	Debug::Printf(kDbgGroup_Script, kDbgMsg_Debug, "Decoded script '%s': %d instructions, %d fused pairs",
+		(instanceof && instanceof->numSections > 0) ? instanceof->sectionNames[0] : "?", (int)decoded.Ops.size(), (int)decoded.FusedOps);
+}
+
 void ccInstance::PushValueToStack(const RuntimeScriptValue &rval) {
 	// Write value to the stack tail and advance stack ptr
 	registers[SREG_SP].WriteValue(rval);
@@ -24,6 +24,7 @@
 
 #include "common/std/memory.h"
 #include "common/std/map.h"
+#include "common/std/vector.h"
 #include "ags/engine/ac/timer.h"
 #include "ags/shared/script/cc_internal.h"
 #include "ags/shared/script/cc_script.h"  // ccScript
@@ -83,6 +84,30 @@ struct ScriptOperation {
 	inline int Arg3i() const { return Args[2].IValue; }
 };
 
+// Pseudo instructions, made of a pair of common instructions which are fused
+// together when the byte-code is pre-decoded
+#define SCMD_FUSED_LOADSPOFFS_MEMREAD  (CC_NUM_SCCMDS + 0) // MAR = SP - arg1; reg = m[MAR]
+#define SCMD_FUSED_LOADSPOFFS_MEMWRITE (CC_NUM_SCCMDS + 1) // MAR = SP - arg1; m[MAR] = reg
+#define SCMD_FUSED_LITTOREG_MEMREAD    (CC_NUM_SCCMDS + 2) // MAR = arg2; reg = m[MAR]
+#define SCMD_FUSED_LITTOREG_MEMWRITE   (CC_NUM_SCCMDS + 3) // MAR = arg2; m[MAR] = reg
+
+// Pre-decoded script instruction
+struct ScriptCodeOp : public ScriptOperation {
+	int32_t Length = 0;         // number of code entries covered, including the arguments
+	int32_t FusedReg = 0;       // register argument of the second fused instruction
+	bool    RuntimeFixup = false; // literal argument of LITTOREG or WRITELIT must be fixed up when run
+};
+
+// Byte-code of a script instance, decoded once all of its fixups are resolved,
+// so that running it does not need to look up the instruction info and apply
+// the static fixups over and over again
+struct ScriptCodeCache {
+	std::vector<ScriptCodeOp> Ops;
+	// Index in Ops of the instruction starting at each code position, or -1
+	std::vector<int32_t>      OpIndex;
+	size_t                    FusedOps = 0;
+};
+
 struct ScriptVariable {
 	ScriptVariable() {
 		ScAddress = -1; // address = 0 is valid one, -1 means undefined
@@ -155,6 +180,9 @@ public:
 
 	char *code_fixups;
 
+	// pre-decoded byte-code, shared with the forks of this instance
+	std::shared_ptr<ScriptCodeCache> decoded_code;
+
 	// returns the currently executing instance, or NULL if none
 	static ccInstance *GetCurrentInstance(void);
 	// clears recorded stack of current instances
@@ -208,6 +236,8 @@ private:
 	bool    AddGlobalVar(const ScriptVariable &glvar);
 	ScriptVariable *FindGlobalVar(int32_t var_addr);
 	bool    CreateRuntimeCodeFixups(const ccScript *scri);
+	// Builds the pre-decoded byte-code, must be done after resolving all fixups
+	void    DecodeCode();
 
 	// Begin executing script starting from the given bytecode index
 	int     Run(int32_t curpc);
@@ -122,6 +122,8 @@ BITMAP *IAGSEngine::GetScreen() {
 		quit("!This plugin requires software graphics driver.");
 
 	Bitmap *buffer = _G(gfxDriver)->GetMemoryBackBuffer();
+	// plugin may paint anywhere on the screen
+	_G(gfxDriver)->MarkBackBufferDirty();
 	return buffer ? (BITMAP *)buffer->GetAllegroBitmap() : nullptr;
 }
 
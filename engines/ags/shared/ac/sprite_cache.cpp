@@ -27,6 +27,8 @@
 
 #include "common/system.h"
 #include "ags/shared/core/platform.h"
+#include "ags/shared/util/compress.h"
+#include "ags/shared/util/memory_stream.h"
 #include "ags/shared/util/stream.h"
 #include "common/std/algorithm.h"
 #include "ags/shared/ac/sprite_cache.h"
@@ -60,7 +62,8 @@ namespace Shared {
 
 SpriteCache::SpriteCache(std::vector<SpriteInfo> &sprInfos, const Callbacks &callbacks)
 	: _sprInfos(sprInfos), _maxCacheSize(DEFAULTCACHESIZE_KB * 1024u),
-	  _cacheSize(0u), _lockedSize(0u) {
+	  _cacheSize(0u), _lockedSize(0u), _maxPackedSize(DEFAULTPACKEDCACHESIZE_KB * 1024u),
+	  _packedSize(0u), _prefetchPos(0u) {
 	_callbacks.AdjustSize = (callbacks.AdjustSize) ? callbacks.AdjustSize : DummyAdjustSize;
 	_callbacks.InitSprite = (callbacks.InitSprite) ? callbacks.InitSprite : DummyInitSprite;
 	_callbacks.PostInitSprite = (callbacks.PostInitSprite) ? callbacks.PostInitSprite : DummyPostInitSprite;
@@ -91,6 +94,23 @@ void SpriteCache::SetMaxCacheSize(size_t size) {
 	_maxCacheSize = size;
 }
 
+size_t SpriteCache::GetPackedCacheSize() const {
+	return _packedSize;
+}
+
+size_t SpriteCache::GetMaxPackedCacheSize() const {
+	return _maxPackedSize;
+}
+
+void SpriteCache::SetMaxPackedCacheSize(size_t size) {
+	_maxPackedSize = size;
+	FreePackedMem(0);
+}
+
+void SpriteCache::ResetStatistics() {
+	_stats = Statistics();
+}
+
 bool SpriteCache::HasFreeSlots() const {
 	return !((_spriteData.size() == SIZE_MAX) || (_spriteData.size() > MAX_SPRITE_INDEX));
 }
@@ -106,6 +126,9 @@ void SpriteCache::Reset() {
 	_mru.clear();
 	_cacheSize = 0;
 	_lockedSize = 0;
+	_packedMru.clear();
+	_packedSize = 0;
+	ClearPrefetch();
 }
 
 bool SpriteCache::SetSprite(sprkey_t index, std::unique_ptr<Bitmap> image, int flags) {
@@ -119,6 +142,7 @@ bool SpriteCache::SetSprite(sprkey_t index, std::unique_ptr<Bitmap> image, int f
 		return false;
 	}
 
+	DropPacked(index);
 	const int spf_flags = flags
 		| (SPF_HICOLOR * image->GetColorDepth() > 8)
 		| (SPF_TRUECOLOR * image->GetColorDepth() > 16);
@@ -227,6 +251,7 @@ Bitmap *SpriteCache::operator[](sprkey_t index) {
 		return _spriteData[index].Image.get();
 	// Either use ready image, or load one from assets
 	if (_spriteData[index].Image) {
+		_stats.Hits++;
 		// Move to the beginning of the MRU list
 		_mru.splice(_mru.begin(), _mru, _spriteData[index].MruIt);
 		return _spriteData[index].Image.get();
@@ -275,6 +300,7 @@ void SpriteCache::DisposeOldest() {
 	// NOTE: locked sprites may still occur in MRU list
 	if (!_spriteData[sprnum].IsLocked()) {
 		_cacheSize -= _spriteData[sprnum].Size;
+		PackSprite(sprnum);
 		_spriteData[sprnum].Image.reset();
 		SprCacheLog("DisposeOldest: disposed %d, size now %d KB", sprnum, _cacheSize / 1024);
 	}
@@ -300,9 +326,13 @@ void SpriteCache::DisposeAllFreeCached() {
 		{
 			_spriteData[i].Image.reset();
 		}
+		// This is meant to release memory, so drop packed images too
+		_spriteData[i].Packed.reset();
 	}
 	_cacheSize = _lockedSize;
 	_mru.clear();
+	_packedMru.clear();
+	_packedSize = 0;
 }
 
 void SpriteCache::PrecacheSprite(sprkey_t index) {
@@ -364,6 +394,14 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 		return 0;
 	assert((_spriteData[index].Flags & SPRCACHEFLAG_ISASSET) != 0);
 
+	// Try restoring the compressed copy first, this is cheaper than reading the file
+	if (_spriteData[index].Packed) {
+		const size_t size = UnpackSprite(index, lock);
+		if (size > 0)
+			return size;
+	}
+
+	const uint32_t load_start = g_system->getMillis();
 	Bitmap *image;
 	HError err = _file.LoadSprite(index, image);
 	if (!image) {
@@ -382,7 +420,21 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 		RemapSpriteToPlaceholder(index);
 		return 0;
 	}
+	_stats.Loads++;
+	_stats.LoadMs += g_system->getMillis() - load_start;
+
+	const size_t size = AddLoadedSprite(index, image, lock);
+	SprCacheLog("Loaded %d, size now %zu KB", index, _cacheSize / 1024);
+
+	// Let the external user to react to the new sprite;
+	// note that this callback is allowed to modify the sprite's pixels,
+	// but not its size or flags.
+	_callbacks.PostInitSprite(index);
+
+	return size;
+}
 
+size_t SpriteCache::AddLoadedSprite(sprkey_t index, Bitmap *image, bool lock) {
 	// save the stored sprite info
 	_sprInfos[index].Width = image->GetWidth();
 	_sprInfos[index].Height = image->GetHeight();
@@ -391,19 +443,129 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 	FreeMem(size);
 	// Add to the cache, lock if requested or if it's sprite 0
 	const bool should_lock = lock || (index == 0);
+	DropPacked(index);
 	_spriteData[index] = SpriteData(image, size, SPRCACHEFLAG_ISASSET);
 	_spriteData[index].Flags |= (SPRCACHEFLAG_LOCKED * should_lock);
 	_cacheSize += size;
-	SprCacheLog("Loaded %d, size now %zu KB", index, _cacheSize / 1024);
+	return size;
+}
 
-	// Let the external user to react to the new sprite;
-	// note that this callback is allowed to modify the sprite's pixels,
-	// but not its size or flags.
-	_callbacks.PostInitSprite(index);
+void SpriteCache::PackSprite(sprkey_t index) {
+	if (_maxPackedSize == 0)
+		return; // compressed tier is disabled
+	const Bitmap *image = _spriteData[index].Image.get();
+	if (!image)
+		return;
+	const int bpp = image->GetBPP();
+	if (bpp != 1 && bpp != 2 && bpp != 4)
+		return; // not supported by the RLE packer
+
+	DropPacked(index);
+	_packBuf.resize(0);
+	{
+		VectorStream mems(_packBuf, kStream_Write);
+		rle_compress(image->GetData(), image->GetDataSize(), bpp, &mems);
+	}
+	// Images which do not pack well are cheaper to simply read again
+	const size_t packed_size = _packBuf.size();
+	if (packed_size >= (size_t)image->GetDataSize() / 4 * 3 || packed_size > _maxPackedSize)
+		return;
+
+	FreePackedMem(packed_size);
+	std::unique_ptr<PackedImage> packed(new PackedImage());
+	packed->Width = image->GetWidth();
+	packed->Height = image->GetHeight();
+	packed->ColorDepth = image->GetColorDepth();
+	packed->Data = _packBuf;
+	packed->MruIt = _packedMru.insert(_packedMru.begin(), index);
+	_spriteData[index].Packed = std::move(packed);
+	_packedSize += packed_size;
+	_stats.Packed++;
+	SprCacheLog("Packed %d, %d -> %zu bytes, packed size now %zu KB",
+		index, image->GetDataSize(), packed_size, _packedSize / 1024);
+}
+
+size_t SpriteCache::UnpackSprite(sprkey_t index, bool lock) {
+	const uint32_t unpack_start = g_system->getMillis();
+	const PackedImage &packed = *_spriteData[index].Packed;
+	std::unique_ptr<Bitmap> image(BitmapHelper::CreateBitmap(packed.Width, packed.Height, packed.ColorDepth));
+	if (image) {
+		VectorStream mems(packed.Data);
+		rle_decompress(image->GetDataForWriting(), image->GetDataSize(), image->GetBPP(), &mems);
+	}
+	DropPacked(index);
+	if (!image)
+		return 0;
+	_stats.PackedHits++;
+	_stats.UnpackMs += g_system->getMillis() - unpack_start;
 
+	// The packed pixels were already initialized when the sprite was first
+	// loaded, so neither InitSprite nor PostInitSprite callbacks are run here.
+	const size_t size = AddLoadedSprite(index, image.release(), lock);
+	SprCacheLog("Unpacked %d, size now %zu KB", index, _cacheSize / 1024);
 	return size;
 }
 
+void SpriteCache::DropPacked(sprkey_t index) {
+	std::unique_ptr<PackedImage> &packed = _spriteData[index].Packed;
+	if (!packed)
+		return;
+	_packedSize -= packed->Data.size();
+	_packedMru.erase(packed->MruIt);
+	packed.reset();
+}
+
+void SpriteCache::FreePackedMem(size_t space) {
+	while (!_packedMru.empty() && (_packedSize + space > _maxPackedSize)) {
+		DropPacked(*std::prev(_packedMru.end()));
+		_stats.PackedDropped++;
+	}
+}
+
+void SpriteCache::QueuePrefetch(sprkey_t index) {
+	if (index < MIN_SPRITE_INDEX || !IsAssetSprite(index) || _spriteData[index].Image)
+		return;
+	_prefetch.push_back(index);
+}
+
+void SpriteCache::ClearPrefetch() {
+	_prefetch.clear();
+	_prefetchPos = 0;
+}
+
+size_t SpriteCache::ProcessPrefetch(uint32_t max_ms) {
+	const uint32_t start = g_system->getMillis();
+	size_t loaded = 0;
+	while (_prefetchPos < _prefetch.size()) {
+		const sprkey_t index = _prefetch[_prefetchPos];
+		// The slot might have changed since the sprite was queued
+		if (!IsAssetSprite(index) || _spriteData[index].IsError() || _spriteData[index].Image) {
+			_prefetchPos++;
+			continue;
+		}
+		// Never dispose anything for the sake of a speculative load;
+		// estimate the image size assuming the largest pixel format
+		const size_t est_size = _sprInfos[index].Width * _sprInfos[index].Height * 4;
+		if (_cacheSize + est_size > _maxCacheSize) {
+			SprCacheLog("Prefetch: cache is full, dropping %zu requests", _prefetch.size() - _prefetchPos);
+			break;
+		}
+
+		_prefetchPos++;
+		if (LoadSprite(index)) {
+			// Put at the end of the MRU list, so that a prefetched sprite
+			// which is not used is the first to go
+			_spriteData[index].MruIt = _mru.insert(_mru.end(), index);
+			_stats.Prefetched++;
+			loaded++;
+		}
+		if (g_system->getMillis() - start >= max_ms)
+			return loaded;
+	}
+	ClearPrefetch();
+	return loaded;
+}
+
 void SpriteCache::RemapSpriteToPlaceholder(sprkey_t index) {
 	assert((index > 0) && ((size_t)index < _spriteData.size()));
 	_sprInfos[index] = SpriteInfo(_placeholder->GetWidth(), _placeholder->GetHeight(), _placeholder->GetColorDepth());
@@ -413,6 +575,7 @@ void SpriteCache::RemapSpriteToPlaceholder(sprkey_t index) {
 
 void SpriteCache::InitNullSprite(sprkey_t index) {
 	assert(index >= 0);
+	DropPacked(index);
 	_sprInfos[index] = SpriteInfo();
 	_spriteData[index] = SpriteData();
 }
@@ -71,6 +71,9 @@ struct SpriteInfo;
 #else
 #define DEFAULTCACHESIZE_KB (128 * 1024)
 #endif
+// Max size of the compressed tier, which keeps the images evicted
+// from the main cache packed in memory, in bytes
+#define DEFAULTPACKEDCACHESIZE_KB (DEFAULTCACHESIZE_KB / 4)
 
 struct SpriteInfo;
 
@@ -95,6 +98,18 @@ public:
 		PfnPrewriteSprite PrewriteSprite;
 	};
 
+	// Cache usage counters, for diagnostic purposes
+	struct Statistics {
+		uint32_t Hits = 0;          // requested image was already in memory
+		uint32_t Loads = 0;         // image had to be read from the sprite file
+		uint32_t PackedHits = 0;    // image was restored from the compressed tier
+		uint32_t Packed = 0;        // evicted images moved to the compressed tier
+		uint32_t PackedDropped = 0; // compressed images dropped to free space
+		uint32_t Prefetched = 0;    // images loaded by the prefetch queue
+		uint32_t LoadMs = 0;        // total time spent reading the sprite file
+		uint32_t UnpackMs = 0;      // total time spent restoring packed images
+	};
+
 	SpriteCache(std::vector<SpriteInfo> &sprInfos, const Callbacks &callbacks);
 	~SpriteCache() = default;
 
@@ -174,6 +189,27 @@ public:
 	void        SetEmptySprite(sprkey_t index, bool as_asset);
 	// Sets max cache size in bytes
 	void        SetMaxCacheSize(size_t size);
+	// Returns current size of the compressed tier, in bytes
+	size_t      GetPackedCacheSize() const;
+	// Returns maximal size limit of the compressed tier, in bytes
+	size_t      GetMaxPackedCacheSize() const;
+	// Sets max compressed tier size in bytes; 0 disables the tier
+	void        SetMaxPackedCacheSize(size_t size);
+	// Returns cache usage counters
+	const Statistics &GetStatistics() const { return _stats; }
+	// Resets cache usage counters
+	void        ResetStatistics();
+
+	// Schedules an asset sprite to be loaded in background by ProcessPrefetch
+	void        QueuePrefetch(sprkey_t index);
+	// Drops all the scheduled prefetch requests
+	void        ClearPrefetch();
+	// Tells if there are scheduled prefetch requests
+	bool        HasPendingPrefetch() const { return _prefetchPos < _prefetch.size(); }
+	// Loads queued sprites until the queue is empty, the time limit is exceeded,
+	// or the cache has no more free space; never evicts anything to do so.
+	// Returns number of the sprites loaded.
+	size_t      ProcessPrefetch(uint32_t max_ms);
 
 	// Loads (if it's not in cache yet) and returns bitmap by the sprite index
 	Bitmap *operator[](sprkey_t index);
@@ -181,6 +217,8 @@ public:
 private:
 	// Load sprite from game resource
 	size_t      LoadSprite(sprkey_t index, bool lock = false);
+	// Register a loaded and initialized image in the cache, returns image size
+	size_t      AddLoadedSprite(sprkey_t index, Bitmap *image, bool lock);
 	// Remap the given index to the placeholder
 	void        RemapSpriteToPlaceholder(sprkey_t index);
 	// Delete the oldest (least recently used) image in cache
@@ -189,6 +227,14 @@ private:
 	void        FreeMem(size_t space);
 	// Initialize the empty sprite slot
 	void 		InitNullSprite(sprkey_t index);
+	// Restore sprite from the compressed tier, returns image size or 0 on failure
+	size_t      UnpackSprite(sprkey_t index, bool lock);
+	// Compress sprite's image into the compressed tier before it's disposed
+	void        PackSprite(sprkey_t index);
+	// Remove sprite's packed image from the compressed tier, if there's one
+	void        DropPacked(sprkey_t index);
+	// Keep dropping oldest packed images until the tier has the given free space
+	void        FreePackedMem(size_t space);
 	//
     // Dummy no-op variants for callbacks
     //
@@ -197,11 +243,23 @@ private:
 	static void   DummyPostInitSprite(sprkey_t) { /* do nothing */ }
 	static void   DummyPrewriteSprite(Bitmap *) { /* do nothing */ }
 
+	// Compressed copy of the evicted sprite image;
+	// the pixels are stored already converted by the InitSprite callback.
+	struct PackedImage {
+		int Width = 0;
+		int Height = 0;
+		int ColorDepth = 0;
+		std::vector<uint8_t> Data; // RLE-packed pixels
+		// Compressed tier MRU list reference
+		std::list<sprkey_t>::iterator MruIt;
+	};
+
 	// Information required for the sprite streaming
 	struct SpriteData {
 		size_t	 Size  = 0;			   // to track cache size, 0 = means don't track
 		uint32_t Flags = 0;			   // SPRCACHEFLAG* flags
 		std::unique_ptr<Bitmap> Image; // actual bitmap
+		std::unique_ptr<PackedImage> Packed; // compressed copy of the disposed bitmap
 
 		// MRU list reference
 		std::list<sprkey_t>::iterator MruIt;
@@ -245,6 +303,20 @@ private:
 	// that were last time used long ago.
 	std::list<sprkey_t> _mru;
 
+	// Compressed tier: keeps images disposed from the main cache packed,
+	// so that they may be restored without reading the sprite file again.
+	size_t _maxPackedSize; // compressed tier size limit
+	size_t _packedSize;    // size in bytes of currently packed images
+	// MRU list of the compressed tier
+	std::list<sprkey_t> _packedMru;
+	// Scratch buffer for compressing images
+	std::vector<uint8_t> _packBuf;
+
+	// Sprites scheduled for the prefetch, and the next one to load
+	std::vector<sprkey_t> _prefetch;
+	size_t _prefetchPos;
+
+	Statistics _stats;
 };
 
 } // namespace Shared
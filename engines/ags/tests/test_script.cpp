@@ -0,0 +1,139 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+#include "common/debug.h"
+#include "common/system.h"
+#include "ags/shared/core/platform.h"
+#include "ags/shared/script/cc_common.h"
+#include "ags/shared/script/cc_internal.h"
+#include "ags/engine/script/cc_instance.h"
+#include "ags/globals.h"
+
+namespace AGS3 {
+
+// Number of loop iterations run by the test script
+#define TEST_SCRIPT_LOOPS 50000
+
+// Builds a script with a function "bench", which sums the numbers below
+// TEST_SCRIPT_LOOPS into a global variable, using a local loop counter.
+// This is the usual code the compiler generates for variable accesses.
+static PScript CreateTestScript() {
+	static const int32_t code[] = {
+		/*  0 */ SCMD_LINENUM, 1,
+		/*  2 */ SCMD_LOOPCHECKOFF,
+		/*  3 */ SCMD_LITTOREG, SREG_AX, 0,
+		/*  6 */ SCMD_PUSHREG, SREG_AX,            // int i = 0
+		// loop:
+		/*  8 */ SCMD_LOADSPOFFS, 4,
+		/* 10 */ SCMD_MEMREAD, SREG_AX,
+		/* 12 */ SCMD_LITTOREG, SREG_BX, TEST_SCRIPT_LOOPS,
+		/* 15 */ SCMD_LESSTHAN, SREG_AX, SREG_BX,
+		/* 18 */ SCMD_JZ, 26,                      // if (i >= TEST_SCRIPT_LOOPS) goto end
+		/* 20 */ SCMD_LITTOREG, SREG_MAR, 0,       // sum
+		/* 23 */ SCMD_MEMREAD, SREG_BX,
+		/* 25 */ SCMD_LOADSPOFFS, 4,
+		/* 27 */ SCMD_MEMREAD, SREG_AX,
+		/* 29 */ SCMD_ADDREG, SREG_BX, SREG_AX,
+		/* 32 */ SCMD_LITTOREG, SREG_MAR, 0,       // sum += i
+		/* 35 */ SCMD_MEMWRITE, SREG_BX,
+		/* 37 */ SCMD_ADD, SREG_AX, 1,
+		/* 40 */ SCMD_LOADSPOFFS, 4,
+		/* 42 */ SCMD_MEMWRITE, SREG_AX,           // i++
+		/* 44 */ SCMD_JMP, -38,                    // goto loop
+		// end:
+		/* 46 */ SCMD_SUB, SREG_SP, 4,
+		/* 49 */ SCMD_LITTOREG, SREG_MAR, 0,
+		/* 52 */ SCMD_MEMREAD, SREG_AX,            // return sum
+		/* 54 */ SCMD_RET
+	};
+	static const int32_t globalFixups[] = { 22, 34, 51 };
+
+	PScript script(new ccScript());
+	script->codesize = ARRAYSIZE(code);
+	script->code = (int32_t *)malloc(sizeof(code));
+	memcpy(script->code, code, sizeof(code));
+
+	script->globaldatasize = sizeof(int32_t);
+	script->globaldata = (char *)calloc(1, script->globaldatasize);
+
+	script->numfixups = ARRAYSIZE(globalFixups);
+	script->fixups = (int32_t *)malloc(sizeof(globalFixups));
+	memcpy(script->fixups, globalFixups, sizeof(globalFixups));
+	script->fixuptypes = (char *)malloc(script->numfixups);
+	memset(script->fixuptypes, FIXUP_GLOBALDATA, script->numfixups);
+
+	// The exports are only freed together with the imports
+	script->imports = (char **)malloc(sizeof(char *));
+	script->numexports = 1;
+	script->exports = (char **)malloc(sizeof(char *));
+	script->exports[0] = scumm_strdup("bench");
+	script->export_addr = (int32_t *)malloc(sizeof(int32_t));
+	script->export_addr[0] = (EXPORT_FUNCTION << 24) | 0;
+
+	return script;
+}
+
+static uint32 Test_RunScript(ccInstance *inst, int runs) {
+	const uint32 start = g_system->getMillis();
+
+	for (int i = 0; i < runs; i++) {
+		// Reset the global sum
+		memset(inst->globaldata, 0, inst->globaldatasize);
+
+		const int result = inst->CallScriptFunction("bench", 0, nullptr);
+		assert(result == 0);
+		(void)result;
+		assert(inst->returnValue == (TEST_SCRIPT_LOOPS - 1) * (TEST_SCRIPT_LOOPS / 2));
+	}
+
+	return g_system->getMillis() - start;
+}
+
+void Test_Script() {
+	PScript script = CreateTestScript();
+	std::unique_ptr<ccInstance> inst = ccInstance::CreateFromScript(script);
+	assert(inst);
+	bool resolved = inst->ResolveScriptImports(script.get());
+	resolved &= inst->ResolveImportFixups(script.get());
+	assert(resolved);
+	(void)resolved;
+	assert(inst->decoded_code);
+
+	// All six variable accesses should have been fused
+#if !DEBUG_CC_EXEC
+	assert(inst->decoded_code->FusedOps == 6);
+#endif
+
+	const int runs = 20;
+	const uint32 decodedTime = Test_RunScript(inst.get(), runs);
+
+	// Run the same code through the path for instructions that could not be
+	// pre-decoded, which reads the byte-code directly
+	inst->decoded_code.reset(new ScriptCodeCache());
+	inst->decoded_code->OpIndex.resize(inst->codesize, -1);
+	const uint32 rawTime = Test_RunScript(inst.get(), runs);
+
+	debug("Script benchmark: %d runs of %d loops, pre-decoded: %u ms, raw: %u ms",
+		runs, TEST_SCRIPT_LOOPS, decodedTime, rawTime);
+}
+
+} // namespace AGS3
@@ -43,9 +43,12 @@
 
 namespace Director {
 
+static uint32 s_pictureVersionCounter = 0;
+
 BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Common::SeekableReadStreamEndian &stream, uint32 castTag, uint16 version, uint8 flags1)
 		: CastMember(cast, castId, stream) {
 	_type = kCastBitmap;
+	pictureChanged();
 	_picture = new Picture();
 	_ditheredImg = nullptr;
 	_matte = nullptr;
@@ -244,6 +247,7 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Common::SeekableRe
 BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Image::ImageDecoder *img, uint8 flags1)
 	: CastMember(cast, castId) {
 	_type = kCastBitmap;
+	pictureChanged();
 	_matte = nullptr;
 	_noMatte = false;
 	_bytes = 0;
@@ -271,6 +275,7 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Image::ImageDecode
 BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, BitmapCastMember &source)
 	: CastMember(cast, castId) {
 	_type = kCastBitmap;
+	pictureChanged();
 	// force a load so we can copy the cast resource information
 	source.load();
 	_loaded = true;
@@ -772,6 +777,7 @@ void BitmapCastMember::load() {
 		} else if ((!pic || (pic->size() == 0)) && (_initialRect.width() == 0) && (_initialRect.height() == 0)) {
 			// If an image is 0x0, it doesn't matter if we don't have any data.
 			_picture->_surface.create(0, 0, g_director->_wm->_pixelformat);
+			pictureChanged();
 			delete pic;
 			_loaded = true;
 			return;
@@ -855,6 +861,7 @@ void BitmapCastMember::unload() {
 
 	delete _picture;
 	_picture = new Picture();
+	pictureChanged();
 
 	if (_ditheredImg) {
 		_ditheredImg->free();
@@ -865,6 +872,10 @@ void BitmapCastMember::unload() {
 	_loaded = false;
 }
 
+void BitmapCastMember::pictureChanged() {
+	_pictureVersion = ++s_pictureVersionCounter;
+}
+
 PictureReference *BitmapCastMember::getPicture() const {
 	auto picture = new PictureReference;
 
@@ -879,6 +890,7 @@ PictureReference *BitmapCastMember::getPicture() const {
 void BitmapCastMember::setPicture(PictureReference &picture) {
 	delete _picture;
 	_picture = new Picture(*picture._picture);
+	pictureChanged();
 
 	// Force redither
 	if (_ditheredImg) {
@@ -895,6 +907,7 @@ void BitmapCastMember::setPicture(PictureReference &picture) {
 void BitmapCastMember::setPicture(Image::ImageDecoder &image, bool adjustSize) {
 	delete _picture;
 	_picture = new Picture(image);
+	pictureChanged();
 	if (adjustSize) {
 		auto surf = image.getSurface();
 		_size = surf->pitch * surf->h + _picture->getPaletteSize();
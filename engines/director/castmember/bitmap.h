@@ -72,6 +72,9 @@ public:
 	uint32 getBITDResourceSize();
 
 	Picture *_picture = nullptr;
+	// Unique across all bitmaps, and renewed whenever _picture is replaced
+	uint32 _pictureVersion;
+	void pictureChanged();
 	Graphics::Surface *_ditheredImg;
 	Graphics::Surface *_matte;
 
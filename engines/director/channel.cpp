@@ -50,6 +50,7 @@ Channel::Channel(Score *sc, Sprite *sp, int priority) {
 	_widget = nullptr;
 	_constraint = 0;
 	_mask = nullptr;
+	_maskPictureVersion = 0;
 
 	_priority = priority;
 
@@ -86,6 +87,7 @@ Channel& Channel::operator=(const Channel &channel) {
 	_widget = nullptr;
 	_constraint = channel._constraint;
 	_mask = nullptr;
+	_maskPictureVersion = 0;
 
 	_priority = channel._priority;
 
@@ -237,14 +239,26 @@ const Graphics::Surface *Channel::getMask(bool forceMatte) {
 				return nullptr;
 			}
 
-			if (_mask) {
-				delete _mask;
-				_mask = nullptr;
-			}
 			if (bitmap->_picture) {
 				// reposition channel bounding box, so origin is at registration offset
 				Common::Point originPos = getPosition();
 				bbox.translate(-originPos.x, -originPos.y);
+
+				// The mask only depends on the mask bitmap and the sprite bounds,
+				// so there is no need to rebuild it while neither changes
+				if (_mask && _maskMemberId == maskID && _maskPictureVersion == bitmap->_pictureVersion &&
+						_maskBbox == bbox && _maskSrcBbox == bitmap->getBbox())
+					return &_mask->rawSurface();
+
+				if (_mask) {
+					delete _mask;
+					_mask = nullptr;
+				}
+				_maskMemberId = maskID;
+				_maskPictureVersion = bitmap->_pictureVersion;
+				_maskBbox = bbox;
+				_maskSrcBbox = bitmap->getBbox();
+
 				// create new mask surface, with the exact dimensions of the channel.
 				_mask = new Graphics::ManagedSurface(bbox.width(), bbox.height());
 				// get the bounding box of the mask image (origin at registration offset)
@@ -114,6 +114,11 @@ public:
 	bool _hideFromStage; // Used in DT for hiding the channel from rendering
 	uint _constraint;
 	Graphics::ManagedSurface *_mask;
+	// What _mask was last built from, so it can be reused on the next draw
+	CastMemberID _maskMemberId;
+	uint32 _maskPictureVersion;
+	Common::Rect _maskBbox;
+	Common::Rect _maskSrcBbox;
 
 	int _priority;
 
@@ -21,6 +21,7 @@
 
 #include "common/language.h"
 #include "common/platform.h"
+#include "common/random.h"
 #include "director/director.h"
 #include "director/debugger.h"
 #include "director/archive.h"
@@ -29,6 +30,7 @@
 #include "director/frame.h"
 #include "director/movie.h"
 #include "director/score.h"
+#include "director/sprite.h"
 #include "director/types.h"
 #include "director/util.h"
 #include "director/window.h"
@@ -61,6 +63,8 @@ Debugger::Debugger(): GUI::Debugger() {
 	registerCmd("channels", WRAP_METHOD(Debugger, cmdChannels));
 	registerCmd("chan", WRAP_METHOD(Debugger, cmdChannels));
 	registerCmd("cast", WRAP_METHOD(Debugger, cmdCast));
+	registerCmd("framejumps", WRAP_METHOD(Debugger, cmdFrameJumps));
+	registerCmd("fj", WRAP_METHOD(Debugger, cmdFrameJumps));
 	registerCmd("nextframe", WRAP_METHOD(Debugger, cmdNextFrame));
 	registerCmd("nf", WRAP_METHOD(Debugger, cmdNextFrame));
 	registerCmd("nextmovie", WRAP_METHOD(Debugger, cmdNextMovie));
@@ -155,6 +159,7 @@ bool Debugger::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" frame / f [frameNum] - Gets or sets the current score frame\n");
 	debugPrintf(" channels / chan [frameNum] - Shows channel information for a score frame\n");
 	debugPrintf(" cast [castNum] - Shows the cast list or castNum for the current movie\n");
+	debugPrintf(" framejumps / fj [n] - Times n random score frame jumps with and without keyframes\n");
 	debugPrintf(" nextframe / nf [n] - Steps forward one or more score frames\n");
 	debugPrintf(" nextmovie / nm - Steps forward until the next change of movie\n");
 	debugPrintf("\n");
@@ -361,6 +366,86 @@ bool Debugger::cmdChannels(int argc, const char **argv) {
 	return true;
 }
 
+static uint32 frameChecksum(const Frame *frame) {
+	uint32 sum = frame->_mainChannels.actionId.member;
+	sum = sum * 31 + frame->_mainChannels.tempo;
+	sum = sum * 31 + frame->_mainChannels.sound1.member;
+	sum = sum * 31 + frame->_mainChannels.sound2.member;
+	sum = sum * 31 + frame->_mainChannels.palette.paletteId.member;
+
+	for (auto &sprite : frame->_sprites) {
+		sum = sum * 31 + sprite->_castId.member;
+		sum = sum * 31 + sprite->_castId.castLib;
+		sum = sum * 31 + sprite->_spriteType;
+		sum = sum * 31 + sprite->_ink;
+		sum = sum * 31 + (uint32)sprite->_startPoint.x;
+		sum = sum * 31 + (uint32)sprite->_startPoint.y;
+		sum = sum * 31 + (uint32)sprite->_width;
+		sum = sum * 31 + (uint32)sprite->_height;
+	}
+	return sum;
+}
+
+bool Debugger::cmdFrameJumps(int argc, const char **argv) {
+	Score *score = g_director->getCurrentMovie()->getScore();
+	int numFrames = score->_scoreCache.size();
+	if (numFrames < 2) {
+		debugPrintf("The current score has too few frames\n");
+		return true;
+	}
+
+	int jumps = (argc == 2) ? atoi(argv[1]) : 0;
+	if (jumps <= 0)
+		jumps = 1000;
+
+	uint16 currentFrame = score->getCurrentFrameNum();
+	uint32 times[2];
+
+	// Both runs go through the same sequence of frames
+	for (int pass = 0; pass < 2; pass++) {
+		Common::RandomSource rnd("framejumps");
+		rnd.setSeed(1);
+
+		score->setKeyframesEnabled(pass == 0);
+
+		uint32 start = g_system->getMillis();
+		for (int i = 0; i < jumps; i++)
+			score->loadFrame(rnd.getRandomNumberRng(1, numFrames), false);
+		times[pass] = g_system->getMillis() - start;
+	}
+
+	// Check that keyframes produce the same channel state as replaying
+	Common::RandomSource rnd("framejumps");
+	rnd.setSeed(1);
+
+	int mismatches = 0;
+	for (int i = 0; i < jumps; i++) {
+		int frameNum = rnd.getRandomNumberRng(1, numFrames);
+
+		score->setKeyframesEnabled(true);
+		score->loadFrame(frameNum, false);
+		uint32 sum = frameChecksum(score->_currentFrame);
+
+		score->setKeyframesEnabled(false);
+		score->loadFrame(frameNum, false);
+		if (sum != frameChecksum(score->_currentFrame)) {
+			if (!mismatches)
+				debugPrintf("Channel state mismatch on frame %d\n", frameNum);
+			mismatches++;
+		}
+	}
+
+	score->setKeyframesEnabled(true);
+	score->loadFrame(currentFrame, true);
+
+	debugPrintf("%d random jumps over %d frames\n", jumps, numFrames);
+	debugPrintf("  keyframes: %d ms (%d keyframes every %d frames, %d bytes)\n", times[0],
+		score->getKeyframeCount(), score->getKeyframeInterval(), score->getKeyframeMemory());
+	debugPrintf("  replay from start: %d ms\n", times[1]);
+	debugPrintf("  mismatches: %d\n", mismatches);
+	return true;
+}
+
 bool Debugger::cmdCast(int argc, const char **argv) {
 	Movie *movie = g_director->getCurrentMovie();
 	Cast *sharedCast = movie->getSharedCast();
@@ -91,6 +91,7 @@ private:
 	bool cmdFrame(int argc, const char **argv);
 	bool cmdChannels(int argc, const char **argv);
 	bool cmdCast(int argc, const char **argv);
+	bool cmdFrameJumps(int argc, const char **argv);
 	bool cmdNextFrame(int argc, const char **argv);
 	bool cmdNextMovie(int argc, const char **argv);
 	bool cmdPrint(int argc, const char **argv);
@@ -740,6 +740,219 @@ void DirectorPlotData::inkBlitShape(Common::Rect &srcRect) {
 	}
 }
 
+// Scanline kernels for the inks which map directly onto bitwise operations
+// on the pixel values. Sprites using one of these inks are drawn a row at a
+// time instead of going through InkPrimitives::drawPoint() for every pixel;
+// the kernel is picked once per blit, and the loops are kept branch-free so
+// that the compiler can vectorise them. Everything else, the arithmetic inks,
+// blending and shapes, still goes through drawPoint().
+
+template <typename T>
+using InkSpanFunc = void (*)(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width);
+
+template <typename T, typename Op>
+static inline void inkSpan(T *dst, const T *src, const byte *msk, int width, Op op) {
+	if (msk) {
+		for (int x = 0; x < width; x++)
+			dst[x] = msk[x] ? (T)op(dst[x], src[x]) : dst[x];
+	} else {
+		for (int x = 0; x < width; x++)
+			dst[x] = (T)op(dst[x], src[x]);
+	}
+}
+
+template <typename T>
+static void inkSpanCopy(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	if (!msk) {
+		memcpy(dst, src, width * sizeof(T));
+		return;
+	}
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return s; });
+}
+
+template <typename T>
+static void inkSpanCopyColor(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	const uint32 black = p->colorBlack, white = p->colorWhite, fore = p->foreColor, back = p->backColor;
+	inkSpan(dst, src, msk, width, [=](uint32 d, uint32 s) { return s == black ? fore : (s == white ? back : d); });
+}
+
+template <typename T>
+static void inkSpanNotCopyColor(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	const uint32 black = p->colorBlack, white = p->colorWhite, fore = p->foreColor, back = p->backColor;
+	inkSpan(dst, src, msk, width, [=](uint32 d, uint32 s) { return s == black ? back : (s == white ? fore : s); });
+}
+
+template <typename T>
+static void inkSpanBackgndTrans(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	const uint32 back = p->backColor;
+	inkSpan(dst, src, msk, width, [=](uint32 d, uint32 s) { return s == back ? d : s; });
+}
+
+// Replaces black source pixels with a colour, leaves the rest of dst alone
+template <typename T>
+static void inkSpanBlackTo(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width, uint32 color) {
+	const uint32 black = p->colorBlack;
+	inkSpan(dst, src, msk, width, [=](uint32 d, uint32 s) { return s == black ? color : d; });
+}
+
+// Replaces white source pixels with a colour, leaves the rest of dst alone
+template <typename T>
+static void inkSpanWhiteTo(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width, uint32 color) {
+	const uint32 white = p->colorWhite;
+	inkSpan(dst, src, msk, width, [=](uint32 d, uint32 s) { return s == white ? color : d; });
+}
+
+template <typename T>
+static void inkSpanBlackToFore(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpanBlackTo(p, dst, src, msk, width, p->foreColor);
+}
+
+template <typename T>
+static void inkSpanBlackToBack(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpanBlackTo(p, dst, src, msk, width, p->backColor);
+}
+
+template <typename T>
+static void inkSpanWhiteToFore(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpanWhiteTo(p, dst, src, msk, width, p->foreColor);
+}
+
+template <typename T>
+static void inkSpanWhiteToBack(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpanWhiteTo(p, dst, src, msk, width, p->backColor);
+}
+
+template <typename T>
+static void inkSpanOr(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return d | s; });
+}
+
+template <typename T>
+static void inkSpanOrNot(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return d | ~s; });
+}
+
+template <typename T>
+static void inkSpanAnd(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return d & s; });
+}
+
+template <typename T>
+static void inkSpanAndNot(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return d & ~s; });
+}
+
+template <typename T>
+static void inkSpanAndNotRGB(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return d & ~(s & 0xffffff00); });
+}
+
+template <typename T>
+static void inkSpanXor(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return d ^ s; });
+}
+
+template <typename T>
+static void inkSpanXorNot(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return d ^ ~s; });
+}
+
+template <typename T>
+static void inkSpanXorRGB(const DirectorPlotData *p, T *dst, const T *src, const byte *msk, int width) {
+	inkSpan(dst, src, msk, width, [](uint32 d, uint32 s) { return d ^ (s & 0xffffff00); });
+}
+
+// Mirrors the per-pixel logic in InkPrimitives::drawPoint() for surfaces,
+// returns nullptr for the inks that have to stay on that path
+template <typename T>
+static InkSpanFunc<T> getInkSpan(const DirectorPlotData *p) {
+	const bool oneByte = sizeof(T) == 1;
+	const bool colorize = p->oneBitImage || p->applyColor;
+
+	switch (p->ink) {
+	case kInkTypeBackgndTrans:
+		if (p->srfMask)
+			return inkSpanCopy<T>;
+		return p->oneBitImage ? inkSpanBlackToFore<T> : inkSpanBackgndTrans<T>;
+	case kInkTypeMatte:
+	case kInkTypeMask:
+	case kInkTypeBlend:
+	case kInkTypeCopy:
+		return p->applyColor ? inkSpanCopyColor<T> : inkSpanCopy<T>;
+	case kInkTypeNotCopy:
+		if (!p->applyColor || sizeof(T) == 2)
+			return nullptr;
+		return oneByte ? inkSpanNotCopyColor<T> : inkSpanCopy<T>;
+	case kInkTypeTransparent:
+		if (colorize)
+			return inkSpanBlackToFore<T>;
+		return oneByte ? inkSpanOr<T> : inkSpanAnd<T>;
+	case kInkTypeNotTrans:
+		if (colorize)
+			return inkSpanWhiteToFore<T>;
+		return oneByte ? inkSpanOrNot<T> : inkSpanAndNotRGB<T>;
+	case kInkTypeReverse:
+		if (!oneByte)
+			return inkSpanXorNot<T>;
+		return colorize ? inkSpanXor<T> : inkSpanBackgndTrans<T>;
+	case kInkTypeNotReverse:
+		return oneByte ? inkSpanXorNot<T> : inkSpanXorRGB<T>;
+	case kInkTypeGhost:
+		if (colorize)
+			return inkSpanBlackToBack<T>;
+		return oneByte ? inkSpanAndNot<T> : inkSpanOrNot<T>;
+	case kInkTypeNotGhost:
+		if (colorize)
+			return inkSpanWhiteToBack<T>;
+		return oneByte ? inkSpanAnd<T> : inkSpanOr<T>;
+	default:
+		return nullptr;
+	}
+}
+
+template <typename T>
+static bool inkBlitSpans(DirectorPlotData *p, const Graphics::Surface *mask, int srcX, int srcY, bool &failedBoundsCheck) {
+	InkSpanFunc<T> span = getInkSpan<T>(p);
+	if (!span)
+		return false;
+
+	const Graphics::ManagedSurface *srf = p->srf;
+	const Graphics::ManagedSurface *srfMask = p->srfMask;
+
+	// Clip the row once instead of checking every pixel
+	int width = p->destRect.width();
+	if (srcX + width > srf->w) {
+		width = MAX(srf->w - srcX, 0);
+		failedBoundsCheck = true;
+	}
+
+	if (srfMask)
+		width = MIN(width, MAX(srfMask->w - srcX, 0));
+
+	if (width <= 0)
+		return true;
+
+	for (int i = 0; i < p->destRect.height(); i++, srcY++) {
+		const byte *msk = mask ? (const byte *)mask->getBasePtr(srcX, srcY) : nullptr;
+
+		if (srfMask) {
+			if (srcY >= srfMask->h)
+				continue;
+
+			msk = (const byte *)srfMask->getBasePtr(srcX, srcY);
+		}
+
+		if (srcY >= srf->h) {
+			failedBoundsCheck = true;
+			continue;
+		}
+
+		span(p, (T *)p->dst->getBasePtr(p->destRect.left, p->destRect.top + i), (const T *)srf->getBasePtr(srcX, srcY), msk, width);
+	}
+
+	return true;
+}
+
 void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Surface *mask) {
 	if (!srf)
 		return;
@@ -779,40 +992,60 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 	// format as the window manager. Most of the time this is
 	// the job of BitmapCastMember::createWidget.
 
-	Graphics::Primitives *primitives = g_director->getInkPrimitives();
+	// Text-like sprites need preprocessColor() on every pixel, and
+	// alpha blending has to look up the palette, so neither can use spans
+	bool textLike = (sprite == kTextSprite || sprite == kButtonSprite || sprite == kCheckboxSprite || sprite == kRadioButtonSprite);
 
-	srcPoint.y = abs(srcRect.top - destRect.top);
-	for (int i = 0; i < destRect.height(); i++, srcPoint.y++) {
-		srcPoint.x = abs(srcRect.left - destRect.left);
-		const byte *msk = mask ? (const byte *)mask->getBasePtr(srcPoint.x, srcPoint.y) : nullptr;
+	bool spans = false;
 
-		if (srfMask) {
-			if (srcPoint.y >= srfMask->h)
-				continue;
+	if (!alpha && !ms && !textLike) {
+		int srcX = abs(srcRect.left - destRect.left);
+		int srcY = abs(srcRect.top - destRect.top);
 
-			msk = (const byte *)srfMask->getBasePtr(srcPoint.x, srcPoint.y);
-		}
+		if (d->_wm->_pixelformat.bytesPerPixel == 1)
+			spans = inkBlitSpans<byte>(this, mask, srcX, srcY, failedBoundsCheck);
+		else if (d->_wm->_pixelformat.bytesPerPixel == 2)
+			spans = inkBlitSpans<uint16>(this, mask, srcX, srcY, failedBoundsCheck);
+		else
+			spans = inkBlitSpans<uint32>(this, mask, srcX, srcY, failedBoundsCheck);
+	}
 
-		for (int j = 0; j < destRect.width(); j++, srcPoint.x++) {
-			if (!srfClip.contains(srcPoint)) {
-				failedBoundsCheck = true;
-				continue;
+	if (!spans) {
+		Graphics::Primitives *primitives = g_director->getInkPrimitives();
+
+		srcPoint.y = abs(srcRect.top - destRect.top);
+		for (int i = 0; i < destRect.height(); i++, srcPoint.y++) {
+			srcPoint.x = abs(srcRect.left - destRect.left);
+			const byte *msk = mask ? (const byte *)mask->getBasePtr(srcPoint.x, srcPoint.y) : nullptr;
+
+			if (srfMask) {
+				if (srcPoint.y >= srfMask->h)
+					continue;
+
+				msk = (const byte *)srfMask->getBasePtr(srcPoint.x, srcPoint.y);
 			}
 
-			// Do not try render beyond the mask bounds
-			if (srfMask && (srcPoint.x >= srfMask->w))
-				continue;
+			for (int j = 0; j < destRect.width(); j++, srcPoint.x++) {
+				if (!srfClip.contains(srcPoint)) {
+					failedBoundsCheck = true;
+					continue;
+				}
 
-			if (!(mask || srfMask) || (msk && (*msk++))) {
-				if (d->_wm->_pixelformat.bytesPerPixel == 1) {
-					primitives->drawPoint(destRect.left + j, destRect.top + i,
-										preprocessColor(*((byte *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
-				} else if (d->_wm->_pixelformat.bytesPerPixel == 2) {
-					primitives->drawPoint(destRect.left + j, destRect.top + i,
-										preprocessColor(*((uint16 *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
-				} else {
-					primitives->drawPoint(destRect.left + j, destRect.top + i,
-										preprocessColor(*((uint32 *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
+				// Do not try render beyond the mask bounds
+				if (srfMask && (srcPoint.x >= srfMask->w))
+					continue;
+
+				if (!(mask || srfMask) || (msk && (*msk++))) {
+					if (d->_wm->_pixelformat.bytesPerPixel == 1) {
+						primitives->drawPoint(destRect.left + j, destRect.top + i,
+											preprocessColor(*((byte *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
+					} else if (d->_wm->_pixelformat.bytesPerPixel == 2) {
+						primitives->drawPoint(destRect.left + j, destRect.top + i,
+											preprocessColor(*((uint16 *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
+					} else {
+						primitives->drawPoint(destRect.left + j, destRect.top + i,
+											preprocessColor(*((uint32 *)srf->getBasePtr(srcPoint.x, srcPoint.y))), this);
+					}
 				}
 			}
 		}
@@ -2612,6 +2612,8 @@ void LB::b_clearGlobals(int nargs) {
 			g_lingo->_globalvars.erase(it._key);
 		}
 	}
+	// Drop the cached locations of removed variables
+	g_lingo->_globalVarsSerial++;
 }
 
 void LB::b_cursor(int nargs) {
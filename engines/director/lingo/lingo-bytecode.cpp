@@ -77,16 +77,16 @@ static const LingoV4Bytecode lingoV4[] = {
 	// 0x44, push a constant
 	{ 0x45, LC::c_namepush,		"bN" },
 	{ 0x46, LC::cb_varrefpush,  "bN" },
-	{ 0x48, LC::cb_globalpush,	"bN" }, // used in event scripts
-	{ 0x49, LC::cb_globalpush,	"bN" },
+	{ 0x48, LC::cb_globalpush,	"bA" }, // used in event scripts
+	{ 0x49, LC::cb_globalpush,	"bA" },
 	{ 0x4a, LC::cb_thepush,		"bN" },
-	{ 0x4b, LC::cb_varpush,		"bpaN" },
-	{ 0x4c, LC::cb_varpush,		"bpvN" },
-	{ 0x4e, LC::cb_globalassign,"bN" }, // used in event scripts
-	{ 0x4f, LC::cb_globalassign,"bN" },
+	{ 0x4b, LC::cb_varpush,		"bpaA" },
+	{ 0x4c, LC::cb_varpush,		"bpvA" },
+	{ 0x4e, LC::cb_globalassign,"bA" }, // used in event scripts
+	{ 0x4f, LC::cb_globalassign,"bA" },
 	{ 0x50, LC::cb_theassign,	"bN" },
-	{ 0x51, LC::cb_varassign,	"bpaN" },
-	{ 0x52, LC::cb_varassign,	"bpvN" },
+	{ 0x51, LC::cb_varassign,	"bpaA" },
+	{ 0x52, LC::cb_varassign,	"bpvA" },
 	{ 0x53, LC::c_jump,			"jb" },
 	{ 0x54, LC::c_jump,			"jbn" },
 	{ 0x55, LC::c_jumpifz,		"jb" },
@@ -114,16 +114,16 @@ static const LingoV4Bytecode lingoV4[] = {
 	// 0x84, push a constant
 	{ 0x85, LC::c_namepush,		"wN" },
 	{ 0x86, LC::cb_varrefpush,  "wN" },
-	{ 0x88, LC::cb_globalpush,	"wN" }, // used in event scripts
-	{ 0x89, LC::cb_globalpush,	"wN" },
+	{ 0x88, LC::cb_globalpush,	"wA" }, // used in event scripts
+	{ 0x89, LC::cb_globalpush,	"wA" },
 	{ 0x8a, LC::cb_thepush,		"wN" },
-	{ 0x8b, LC::cb_varpush,		"wpaN" },
-	{ 0x8c, LC::cb_varpush,		"wpvN" },
-	{ 0x8e, LC::cb_globalassign,"wN" }, // used in event scripts
-	{ 0x8f, LC::cb_globalassign,"wN" },
+	{ 0x8b, LC::cb_varpush,		"wpaA" },
+	{ 0x8c, LC::cb_varpush,		"wpvA" },
+	{ 0x8e, LC::cb_globalassign,"wA" }, // used in event scripts
+	{ 0x8f, LC::cb_globalassign,"wA" },
 	{ 0x90, LC::cb_theassign, 	"wN" },
-	{ 0x91, LC::cb_varassign,	"wpaN" },
-	{ 0x92, LC::cb_varassign,	"wpvN" },
+	{ 0x91, LC::cb_varassign,	"wpaA" },
+	{ 0x92, LC::cb_varassign,	"wpvA" },
 	{ 0x93, LC::c_jump,			"jw" },
 	{ 0x94, LC::c_jump,			"jwn" },
 	{ 0x95, LC::c_jumpifz,		"jw" },
@@ -570,22 +570,18 @@ void LC::cb_call() {
 
 
 void LC::cb_globalpush() {
-	Common::String name = g_lingo->readString();
-	Datum target(name);
-	target.type = GLOBALREF;
-	debugC(3, kDebugLingoExec, "cb_globalpush: pushing %s to stack", name.c_str());
-	Datum result = g_lingo->varFetch(target);
+	int atom = g_lingo->readInt();
+	debugC(3, kDebugLingoExec, "cb_globalpush: pushing %s to stack", g_lingo->getAtom(atom).c_str());
+	Datum result = g_lingo->varFetch(GLOBALREF, atom);
 	g_lingo->push(result);
 }
 
 
 void LC::cb_globalassign() {
-	Common::String name = g_lingo->readString();
-	Datum target(name);
-	target.type = GLOBALREF;
-	debugC(3, kDebugLingoExec, "cb_globalassign: assigning to %s", name.c_str());
+	int atom = g_lingo->readInt();
+	debugC(3, kDebugLingoExec, "cb_globalassign: assigning to %s", g_lingo->getAtom(atom).c_str());
 	Datum source = g_lingo->pop();
-	g_lingo->varAssign(target, source);
+	g_lingo->varAssign(GLOBALREF, atom, source);
 }
 
 void LC::cb_objectfieldassign() {
@@ -682,23 +678,19 @@ void LC::cb_thepush2() {
 }
 
 void LC::cb_varpush() {
-	Common::String name = g_lingo->readString();
-	Datum target(name);
-	target.type = LOCALREF;
-	debugC(3, kDebugLingoExec, "cb_varpush: pushing %s to stack", name.c_str());
-	Datum result = g_lingo->varFetch(target);
+	int atom = g_lingo->readInt();
+	debugC(3, kDebugLingoExec, "cb_varpush: pushing %s to stack", g_lingo->getAtom(atom).c_str());
+	Datum result = g_lingo->varFetch(LOCALREF, atom);
 	g_lingo->push(result);
 }
 
 
 void LC::cb_varassign() {
-	Common::String name = g_lingo->readString();
-	Datum target(name);
-	target.type = LOCALREF;
-	debugC(3, kDebugLingoExec, "cb_varassign: assigning to %s", name.c_str());
+	int atom = g_lingo->readInt();
+	debugC(3, kDebugLingoExec, "cb_varassign: assigning to %s", g_lingo->getAtom(atom).c_str());
 	Datum source = g_lingo->pop();
 	// Local variables should be initialised by the script, no varCreate here
-	g_lingo->varAssign(target, source);
+	g_lingo->varAssign(LOCALREF, atom, source);
 }
 
 
@@ -1529,6 +1521,7 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 				size_t argc = strlen(g_lingo->_lingoV4[opcode]->proto);
 				if (argc) {
 					bool codeName = false;
+					bool codeAtom = false;
 					int arg = 0;
 					for (uint c = 0; c < argc; c++) {
 						switch (g_lingo->_lingoV4[opcode]->proto[c]) {
@@ -1601,12 +1594,18 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 							// argument is a name in the name table
 							codeName = true;
 							break;
+						case 'A':
+							// argument is a variable name in the name table, coded as an atom
+							codeAtom = true;
+							break;
 						default:
 							break;
 						}
 					}
 					if (codeName) {
 						codeString(_assemblyArchive->getName(arg).c_str());
+					} else if (codeAtom) {
+						codeInt(g_lingo->internAtom(_assemblyArchive->getName(arg)));
 					} else {
 						codeInt(arg);
 					}
@@ -89,8 +89,8 @@ static const struct FuncDescr {
 	{ LC::c_fieldref,		"c_fieldref",		"" },
 	{ LC::c_floatpush,		"c_floatpush",		"f" },
 	{ LC::c_globalinit,		"c_globalinit",		"s" },
-	{ LC::c_globalpush,		"c_globalpush",		"s" },
-	{ LC::c_globalrefpush,	"c_globalrefpush",	"s" },
+	{ LC::c_globalpush,		"c_globalpush",		"A" },
+	{ LC::c_globalrefpush,	"c_globalrefpush",	"A" },
 	{ LC::c_ge,				"c_ge",				"" },
 	{ LC::c_gt,				"c_gt",				"" },
 	{ LC::c_hilite,			"c_hilite",			"" },
@@ -103,8 +103,8 @@ static const struct FuncDescr {
 	{ LC::c_le,				"c_le",				"" },
 	{ LC::c_lineToOf,		"c_lineToOf",		"" },	// D3
 	{ LC::c_lineToOfRef,	"c_lineToOfRef",	"" },	// D3
-	{ LC::c_localpush,		"c_localpush",		"s" },
-	{ LC::c_localrefpush,	"c_localrefpush",	"s" },
+	{ LC::c_localpush,		"c_localpush",		"A" },
+	{ LC::c_localrefpush,	"c_localrefpush",	"A" },
 	{ LC::c_lt,				"c_lt",				"" },
 	{ LC::c_mod,			"c_mod",			"" },
 	{ LC::c_mul,			"c_mul",			"" },
@@ -118,8 +118,8 @@ static const struct FuncDescr {
 	{ LC::c_or,				"c_or",				"" },
 	{ LC::c_procret,		"c_procret",		"" },
 	{ LC::c_proparraypush,	"c_proparraypush",	"i" },
-	{ LC::c_proppush,		"c_proppush",		"s" },
-	{ LC::c_proprefpush,	"c_proprefpush",	"s" },
+	{ LC::c_proppush,		"c_proppush",		"A" },
+	{ LC::c_proprefpush,	"c_proprefpush",	"A" },
 	{ LC::c_putafter,		"c_putafter",		"" },	// D3
 	{ LC::c_putbefore,		"c_putbefore",		"" },	// D3
 	{ LC::c_starts,			"c_starts",			"" },
@@ -132,8 +132,8 @@ static const struct FuncDescr {
 	{ LC::c_theentityassign,"c_theentityassign","EF" },
 	{ LC::c_theentitypush,	"c_theentitypush",	"EF" }, // entity, field
 	{ LC::c_themenuentitypush,"c_themenuentitypush","EF" },
-	{ LC::c_varpush,		"c_varpush",		"s" },
-	{ LC::c_varrefpush,		"c_varrefpush",		"s" },
+	{ LC::c_varpush,		"c_varpush",		"A" },
+	{ LC::c_varrefpush,		"c_varrefpush",		"A" },
 	{ LC::c_voidpush,		"c_voidpush",		""  },
 	{ LC::c_whencode,		"c_whencode",		"s" },
 	{ LC::c_within,			"c_within",			"" },
@@ -143,8 +143,8 @@ static const struct FuncDescr {
 	{ LC::cb_call,			"cb_call",			"s" },
 	{ LC::cb_delete,		"cb_delete",		"i" },
 	{ LC::cb_hilite,		"cb_hilite",		"" },
-	{ LC::cb_globalassign,	"cb_globalassign",	"s" },
-	{ LC::cb_globalpush,	"cb_globalpush",	"s" },
+	{ LC::cb_globalassign,	"cb_globalassign",	"A" },
+	{ LC::cb_globalpush,	"cb_globalpush",	"A" },
 	{ LC::cb_list,			"cb_list",			"" },
 	{ LC::cb_proplist,		"cb_proplist",		"" },
 	{ LC::cb_localcall,		"cb_localcall",		"i" },
@@ -159,8 +159,8 @@ static const struct FuncDescr {
 	{ LC::cb_unk,			"cb_unk",			"i" },
 	{ LC::cb_unk1,			"cb_unk1",			"ii" },
 	{ LC::cb_unk2,			"cb_unk2",			"iii" },
-	{ LC::cb_varassign,		"cb_varassign",		"s" },
-	{ LC::cb_varpush,		"cb_varpush",		"s" },
+	{ LC::cb_varassign,		"cb_varassign",		"A" },
+	{ LC::cb_varpush,		"cb_varpush",		"A" },
 	{ LC::cb_v4assign,		"cb_v4assign",		"i" },
 	{ LC::cb_v4assign2,		"cb_v4assign2",		"i" },
 	{ LC::cb_v4theentitypush,"cb_v4theentitypush","i" },
@@ -237,6 +237,7 @@ void Lingo::pushContext(const Symbol funcSym, bool allowRetVal, Datum defaultRet
 	fp->retScript = _state->script;
 	fp->retContext = _state->context;
 	fp->retLocalVars = _state->localVars;
+	fp->retLocalVarsSerial = _state->localVarsSerial;
 	fp->retMe = _state->me;
 	fp->sp = funcSym;
 	fp->allowRetVal = allowRetVal;
@@ -308,6 +309,7 @@ void Lingo::pushContext(const Symbol funcSym, bool allowRetVal, Datum defaultRet
 		}
 	}
 	_state->localVars = localvars;
+	_state->localVarsSerial = ++_localVarsSerial;
 
 	fp->stackSizeBefore = _state->stack.size();
 
@@ -372,6 +374,7 @@ void Lingo::popContext(bool aborting) {
 	}
 	cleanLocalVars();
 	_state->localVars = fp->retLocalVars;
+	_state->localVarsSerial = fp->retLocalVarsSerial;
 
 	if (debugChannelSet(2, kDebugLingoExec)) {
 		printCallStack(_state->pc);
@@ -520,55 +523,43 @@ void LC::c_globalinit() {
 }
 
 void LC::c_varrefpush() {
-	Common::String name(g_lingo->readString());
-	Datum d(name);
+	Datum d(g_lingo->getAtom(g_lingo->readInt()));
 	d.type = VARREF;
 	g_lingo->push(d);
 }
 
 void LC::c_globalrefpush() {
-	Common::String name(g_lingo->readString());
-	Datum d(name);
+	Datum d(g_lingo->getAtom(g_lingo->readInt()));
 	d.type = GLOBALREF;
 	g_lingo->push(d);
 }
 
 void LC::c_localrefpush() {
-	Common::String name(g_lingo->readString());
-	Datum d(name);
+	Datum d(g_lingo->getAtom(g_lingo->readInt()));
 	d.type = LOCALREF;
 	g_lingo->push(d);
 }
 
 void LC::c_proprefpush() {
-	Common::String name(g_lingo->readString());
-	Datum d(name);
+	Datum d(g_lingo->getAtom(g_lingo->readInt()));
 	d.type = PROPREF;
 	g_lingo->push(d);
 }
 
 void LC::c_varpush() {
-	LC::c_varrefpush();
-	Datum d = g_lingo->pop();
-	g_lingo->push(g_lingo->varFetch(d));
+	g_lingo->push(g_lingo->varFetch(VARREF, g_lingo->readInt()));
 }
 
 void LC::c_globalpush() {
-	LC::c_globalrefpush();
-	Datum d = g_lingo->pop();
-	g_lingo->push(g_lingo->varFetch(d));
+	g_lingo->push(g_lingo->varFetch(GLOBALREF, g_lingo->readInt()));
 }
 
 void LC::c_localpush() {
-	LC::c_localrefpush();
-	Datum d = g_lingo->pop();
-	g_lingo->push(g_lingo->varFetch(d));
+	g_lingo->push(g_lingo->varFetch(LOCALREF, g_lingo->readInt()));
 }
 
 void LC::c_proppush() {
-	LC::c_proprefpush();
-	Datum d = g_lingo->pop();
-	g_lingo->push(g_lingo->varFetch(d));
+	g_lingo->push(g_lingo->varFetch(PROPREF, g_lingo->readInt()));
 }
 
 void LC::c_stackpeek() {
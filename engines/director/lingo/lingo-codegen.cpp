@@ -369,7 +369,7 @@ void LingoCompiler::codeVarRef(const Common::String &name) {
 		code1(LC::c_proprefpush);
 		break;
 	}
-	codeString(name.c_str());
+	codeInt(g_lingo->internAtom(name));
 }
 
 void LingoCompiler::codeVarGet(const Common::String &name) {
@@ -397,7 +397,7 @@ void LingoCompiler::codeVarGet(const Common::String &name) {
 		code1(LC::c_proppush);
 		break;
 	}
-	codeString(name.c_str());
+	codeInt(g_lingo->internAtom(name));
 }
 
 void LingoCompiler::registerMethodVar(const Common::String &name, VarType type) {
@@ -182,6 +182,8 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 
 	_state = nullptr;
 	_globalCounter = 0;
+	_globalVarsSerial = 1;
+	_localVarsSerial = 0;
 	_freezeState = false;
 	_freezePlay = false;
 	_playDone = false;
@@ -555,6 +557,14 @@ Common::String Lingo::decodeInstruction(ScriptData *sd, uint pc, uint *newPc) {
 					res += Common::String::format(" \"%s\"", s);
 					break;
 				}
+			case 'A':
+				{
+					i = (*sd)[pc++];
+					int v = READ_UINT32(&i);
+
+					res += Common::String::format(" \"%s\"", getAtom(v).c_str());
+					break;
+				}
 			case 'E':
 				{
 					i = (*sd)[pc++];
@@ -1663,6 +1673,7 @@ void Lingo::cleanLocalVars() {
 	delete _state->localVars;
 
 	_state->localVars = nullptr;
+	_state->localVarsSerial = 0;
 }
 
 Common::String Lingo::formatAllVars() {
@@ -1727,11 +1738,14 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
-				g_debugger->varWriteHook(name);
-				return;
+			const Common::String &name = *var.u.s;
+			if (_state->localVars) {
+				DatumHash::iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end()) {
+					it->_value = value;
+					g_debugger->varWriteHook(name);
+					return;
+				}
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				_state->me.u.obj->setProp(name, value);
@@ -1752,9 +1766,10 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
+			const Common::String &name = *var.u.s;
+			DatumHash::iterator it;
+			if (_state->localVars && (it = _state->localVars->find(name)) != _state->localVars->end()) {
+				it->_value = value;
 				g_debugger->varWriteHook(name);
 			} else {
 				warning("varAssign: local variable %s not defined", name.c_str());
@@ -1844,18 +1859,18 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 	switch (var.type) {
 	case VARREF:
 		{
-			Datum d;
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
 
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			DatumHash::iterator it;
+			if (_state->localVars && (it = _state->localVars->find(name)) != _state->localVars->end()) {
+				return it->_value;
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				return _state->me.u.obj->getProp(name);
 			}
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			if ((it = _globalvars.find(name)) != _globalvars.end()) {
+				return it->_value;
 			}
 
 			if (!silent)
@@ -1865,10 +1880,11 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case GLOBALREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::iterator it = _globalvars.find(name);
+			if (it != _globalvars.end()) {
+				return it->_value;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: global variable %s not defined", name.c_str());
 			return result;
@@ -1876,10 +1892,11 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
+			const Common::String &name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			DatumHash::iterator it;
+			if (_state->localVars && (it = _state->localVars->find(name)) != _state->localVars->end()) {
+				return it->_value;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: local variable %s not defined", name.c_str());
 			return result;
@@ -1912,6 +1929,136 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 	return result;
 }
 
+int Lingo::internAtom(const Common::String &name) {
+	AtomHash::iterator it = _atomIds.find(name);
+	if (it != _atomIds.end())
+		return it->_value;
+
+	int atom = _atoms.size();
+	_atoms.push_back(name);
+	_atomSlots.push_back(AtomSlot());
+	_atomIds[name] = atom;
+	return atom;
+}
+
+// Variable values live in hash nodes, which stay put until the variable is
+// removed, so the slots may keep pointers to them. Local variables are bound
+// to the serial of the frame they were found in, globals are dropped whenever
+// any global variable gets removed. Misses are not cached, as the variable
+// may be created later.
+Datum *Lingo::findLocalVar(int atom) {
+	if (!_state->localVars)
+		return nullptr;
+
+	AtomSlot &slot = _atomSlots[atom];
+	if (slot.local && slot.localSerial == _state->localVarsSerial)
+		return slot.local;
+
+	DatumHash::iterator it = _state->localVars->find(_atoms[atom]);
+	if (it == _state->localVars->end())
+		return nullptr;
+	slot.local = &it->_value;
+	slot.localSerial = _state->localVarsSerial;
+	return slot.local;
+}
+
+Datum *Lingo::findGlobalVar(int atom) {
+	AtomSlot &slot = _atomSlots[atom];
+	if (slot.global && slot.globalSerial == _globalVarsSerial)
+		return slot.global;
+
+	DatumHash::iterator it = _globalvars.find(_atoms[atom]);
+	if (it == _globalvars.end())
+		return nullptr;
+	slot.global = &it->_value;
+	slot.globalSerial = _globalVarsSerial;
+	return slot.global;
+}
+
+void Lingo::varAssign(DatumType type, int atom, const Datum &value) {
+	const Common::String &name = _atoms[atom];
+	Datum *var = nullptr;
+
+	switch (type) {
+	case VARREF:
+		var = findLocalVar(atom);
+		if (!var && _state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
+			_state->me.u.obj->setProp(name, value);
+			g_debugger->varWriteHook(name);
+			return;
+		}
+		// fall through
+	case GLOBALREF:
+		if (!var)
+			var = findGlobalVar(atom);
+		if (!var) {
+			_globalvars[name] = value;
+			g_debugger->varWriteHook(name);
+			return;
+		}
+		break;
+	case LOCALREF:
+		var = findLocalVar(atom);
+		if (!var) {
+			warning("varAssign: local variable %s not defined", name.c_str());
+			return;
+		}
+		break;
+	case PROPREF:
+		if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
+			_state->me.u.obj->setProp(name, value);
+			g_debugger->varWriteHook(name);
+		} else {
+			warning("varAssign: property %s not defined", name.c_str());
+		}
+		return;
+	default:
+		warning("varAssign: assignment to non-variable");
+		return;
+	}
+
+	*var = value;
+	g_debugger->varWriteHook(name);
+}
+
+Datum Lingo::varFetch(DatumType type, int atom) {
+	const Common::String &name = _atoms[atom];
+	Datum *var = nullptr;
+	g_debugger->varReadHook(name);
+
+	switch (type) {
+	case VARREF:
+		var = findLocalVar(atom);
+		if (!var && _state->me.type == OBJECT && _state->me.u.obj->hasProp(name))
+			return _state->me.u.obj->getProp(name);
+		if (!var)
+			var = findGlobalVar(atom);
+		if (!var)
+			debugC(1, kDebugLingoExec, "varFetch: variable %s not found", name.c_str());
+		break;
+	case GLOBALREF:
+		var = findGlobalVar(atom);
+		if (!var)
+			debugC(1, kDebugLingoExec, "varFetch: global variable %s not defined", name.c_str());
+		break;
+	case LOCALREF:
+		var = findLocalVar(atom);
+		if (!var)
+			debugC(1, kDebugLingoExec, "varFetch: local variable %s not defined", name.c_str());
+		break;
+	case PROPREF:
+		if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name))
+			return _state->me.u.obj->getProp(name);
+		warning("varFetch: property %s not defined", name.c_str());
+		break;
+	default:
+		warning("varFetch: fetch from non-variable");
+		break;
+	}
+
+	return var ? *var : Datum();
+}
+
 Common::U32String Lingo::evalChunkRef(const Datum &var) {
 	Common::U32String result;
 
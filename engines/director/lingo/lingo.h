@@ -240,6 +240,7 @@ typedef Common::HashMap<Common::String, Symbol, Common::IgnoreCase_Hash, Common:
 typedef Common::HashMap<Common::String, Datum, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> DatumHash;
 typedef Common::HashMap<Common::String, Builtin *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> BuiltinHash;
 typedef Common::HashMap<Common::String, VarType, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> VarTypeHash;
+typedef Common::HashMap<Common::String, int> AtomHash;
 typedef void (*XLibOpenerFunc)(ObjectType, const Common::Path &);
 typedef void (*XLibCloserFunc)(ObjectType);
 typedef Common::HashMap<Common::String, XLibOpenerFunc, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> XLibOpenerFuncHash;
@@ -257,6 +258,7 @@ struct CFrame {	/* proc/func call stack frame */
 	ScriptData		*retScript;			/* which script to resume after return */
 	ScriptContext	*retContext;		/* which script context to use after return */
 	DatumHash		*retLocalVars;
+	uint32			retLocalVarsSerial;
 	Datum			retMe;				/* which me obj to use after return */
 	uint			stackSizeBefore;
 	bool			allowRetVal;		/* whether to allow a return value */
@@ -351,6 +353,7 @@ struct LingoState {
 	ScriptData *script = nullptr;			// current Lingo script
 	ScriptContext *context = nullptr;		// current Lingo script context
 	DatumHash *localVars = nullptr;			// current local variables
+	uint32 localVarsSerial = 0;				// unique id of localVars, for the atom slot cache
 	Datum me;								// current me object
 	StackData stack;
 	int currentChannelId = 0;
@@ -435,6 +438,10 @@ public:
 	void cleanLocalVars();
 	void varAssign(const Datum &var, const Datum &value);
 	Datum varFetch(const Datum &var, bool silent = false);
+	void varAssign(DatumType type, int atom, const Datum &value);
+	Datum varFetch(DatumType type, int atom);
+	int internAtom(const Common::String &name);
+	const Common::String &getAtom(int atom) const { return _atoms[atom]; }
 	Common::U32String evalChunkRef(const Datum &var);
 	Datum findVarV4(int varType, const Datum &id);
 	CastMemberID resolveCastMember(const Datum &memberID, const Datum &castLib, CastType type);
@@ -564,6 +571,27 @@ public:
 	Common::HashMap<Common::String, Audio::AudioStream *> _audioAliases;
 
 	DatumHash _globalvars;
+	uint32 _globalVarsSerial;
+
+private:
+	Datum *findLocalVar(int atom);
+	Datum *findGlobalVar(int atom);
+
+	// Variable names interned by the compiler. Instructions referring to variables
+	// store the atom number instead of the name, and the atom slots remember
+	// where the variable was last found, so that it's not hashed on every access.
+	struct AtomSlot {
+		Datum *local = nullptr;
+		uint32 localSerial = 0;
+		Datum *global = nullptr;
+		uint32 globalSerial = 0;
+	};
+	Common::Array<Common::String> _atoms;
+	Common::Array<AtomSlot> _atomSlots;
+	AtomHash _atomIds;
+	uint32 _localVarsSerial;
+
+public:
 
 	FuncHash _functions;
 
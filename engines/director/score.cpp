@@ -55,6 +55,11 @@ namespace Director {
 
 #include "director/palette-fade.h"
 
+enum {
+	kKeyframeInterval = 32,
+	kKeyframeMemoryBudget = 4 * 1024 * 1024
+};
+
 Score::Score(Movie *movie, bool haveInteractivity) {
 	_movie = movie;
 	_window = movie->getWindow();
@@ -96,6 +101,10 @@ Score::Score(Movie *movie, bool haveInteractivity) {
 	_framesStream = nullptr;
 	_currentFrame = nullptr;
 
+	_keyframeInterval = kKeyframeInterval;
+	_keyframeMemory = 0;
+	_keyframesEnabled = true;
+
 	_disableGoPlayUpdateStage = false;
 }
 
@@ -112,6 +121,8 @@ Score::~Score() {
 	for (auto &it : _scoreCache)
 		delete it;
 
+	clearKeyframes();
+
 	if (_framesStream)
 		delete _framesStream;
 
@@ -1877,6 +1888,8 @@ void Score::loadFrames(Common::SeekableReadStreamEndian &stream, uint16 version,
 	_frameDataOffset = 0;
 	_maxChannelsUsed = 0;
 
+	clearKeyframes();
+
 	if (version < kFileVer100) {
 		_framesStreamSize = _framesStream->readUint32();
 		_numChannelsDisplayed = 24;
@@ -2158,7 +2171,14 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 	int sourceFrame = _curFrameNumber;
 	int targetFrame = frameNum;
 
-	if (frameNum <= (int)_curFrameNumber) {
+	bool rewind = frameNum <= (int)_curFrameNumber;
+	uint32 keyframe = frameNum > 0 ? restoreKeyframe(frameNum) : 0;
+
+	if (keyframe) {
+		debugC(7, kDebugLoading, "****** Restored keyframe %d for frame %d", keyframe, frameNum);
+		sourceFrame = keyframe;
+		rewind = true;
+	} else if (rewind) {
 		debugC(7, kDebugLoading, "****** Resetting frame %d to start 0x%x", sourceFrame, (uint32)_framesStream->pos());
 		// If we are going back, we need to rebuild frames from start
 		_currentFrame->reset();
@@ -2174,7 +2194,7 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 
 	// Reset the copyback mask on all sprites, so we know what changed
 	for (auto &it : _currentFrame->_sprites) {
-		if (frameNum <= (int)_curFrameNumber) {
+		if (rewind) {
 			// starting from rewind, copy back everything
 			it->_copyBackMask = static_cast<uint32>(-1);
 		} else {
@@ -2188,6 +2208,7 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 	_curFrameNumber = sourceFrame + 1;
 	while (sourceFrame < targetFrame - 1 && readOneFrame()) {
 		sourceFrame++;
+		storeKeyframe(sourceFrame);
 		_curFrameNumber = sourceFrame + 1;
 	}
 
@@ -2198,6 +2219,8 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 	if (!isFrameRead)
 		return false;
 
+	storeKeyframe(targetFrame);
+
 	int64 pos = _framesStream->pos();
 
 	if (_version >= kFileVer600)
@@ -2216,6 +2239,86 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 	return true;
 }
 
+void Score::storeKeyframe(uint32 frameNum) {
+	// Keyframes are only ever appended in order, so a frame qualifies
+	// only when it is the next one in the sequence
+	if (!_keyframesEnabled || frameNum != (_keyframes.size() + 1) * _keyframeInterval)
+		return;
+
+	uint32 size = sizeof(Frame) + _currentFrame->_sprites.size() * (sizeof(Sprite *) + sizeof(Sprite));
+
+	if (_keyframeMemory + size > kKeyframeMemoryBudget) {
+		// Over budget, thin out the keyframes we have and space them wider
+		uint kept = 0;
+		for (uint i = 0; i < _keyframes.size(); i++) {
+			if (i % 2 == 1) {
+				_keyframes[kept++] = _keyframes[i];
+			} else {
+				delete _keyframes[i].frame;
+				_keyframeMemory -= size;
+			}
+		}
+		_keyframes.resize(kept);
+		_keyframeInterval *= 2;
+
+		debugC(3, kDebugLoading, "Score::storeKeyframe(): Over budget, keyframe interval is now %d", _keyframeInterval);
+
+		if (frameNum != (_keyframes.size() + 1) * _keyframeInterval)
+			return;
+	}
+
+	ScoreKeyframe keyframe;
+	keyframe.frameNum = frameNum;
+	keyframe.position = _framesStream->pos();
+	keyframe.frame = new Frame(*_currentFrame);
+	// The copy constructor does not take over every main channel field
+	keyframe.frame->_mainChannels = _currentFrame->_mainChannels;
+
+	_keyframes.push_back(keyframe);
+	_keyframeMemory += size;
+
+	debugC(5, kDebugLoading, "Score::storeKeyframe(): Keyframe for frame %d at 0x%x", frameNum, (uint32)keyframe.position);
+}
+
+uint32 Score::restoreKeyframe(uint32 frameNum) {
+	// The target frame itself always has to be read, so look for the
+	// closest keyframe before it
+	if (!_keyframesEnabled || _keyframes.empty() || frameNum <= _keyframeInterval)
+		return 0;
+
+	uint idx = MIN<uint>((frameNum - 1) / _keyframeInterval, _keyframes.size()) - 1;
+	const ScoreKeyframe &keyframe = _keyframes[idx];
+
+	// A forward jump that does not pass a keyframe is cheaper to
+	// read on from the current position
+	if (frameNum > _curFrameNumber && keyframe.frameNum <= _curFrameNumber)
+		return 0;
+
+	_currentFrame->_mainChannels = keyframe.frame->_mainChannels;
+
+	uint numSprites = MIN(_currentFrame->_sprites.size(), keyframe.frame->_sprites.size());
+	for (uint i = 0; i < numSprites; i++) {
+		*_currentFrame->_sprites[i] = *keyframe.frame->_sprites[i];
+		_currentFrame->_sprites[i]->_frame = _currentFrame;
+		// Cast pointers may be stale by now, same as a rewind they are
+		// set up again by setSpriteCasts()
+		_currentFrame->_sprites[i]->_cast = nullptr;
+	}
+
+	_framesStream->seek(keyframe.position, SEEK_SET);
+
+	return keyframe.frameNum;
+}
+
+void Score::clearKeyframes() {
+	for (auto &it : _keyframes)
+		delete it.frame;
+
+	_keyframes.clear();
+	_keyframeInterval = kKeyframeInterval;
+	_keyframeMemory = 0;
+}
+
 bool Score::readOneFrame() {
 	uint16 channelSize;
 	uint16 channelOffset;
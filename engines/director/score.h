@@ -63,6 +63,14 @@ struct Label {
 	Label(Common::String name1, uint16 number1, Common::String comment1) { name = name1; number = number1; comment = comment1;}
 };
 
+// Full copy of the channel state right after a frame has been read,
+// together with the frames stream position of the next frame
+struct ScoreKeyframe {
+	uint32 frameNum;
+	int64 position;
+	Frame *frame;
+};
+
 class Score {
 public:
 	Score(Movie *movie, bool haveInteractivity);
@@ -73,6 +81,10 @@ public:
 	void loadFrames(Common::SeekableReadStreamEndian &stream, uint16 version, bool loadSprites = false);
 	bool loadFrame(int frame, bool loadCast);
 	bool readOneFrame();
+	void setKeyframesEnabled(bool enabled) { _keyframesEnabled = enabled; }
+	uint getKeyframeCount() const { return _keyframes.size(); }
+	uint getKeyframeInterval() const { return _keyframeInterval; }
+	uint32 getKeyframeMemory() const { return _keyframeMemory; }
 	void updateFrame(Frame *frame);
 	Frame *getFrameData(int frameNum);
 
@@ -170,6 +182,10 @@ private:
 
 	void loadFrameSpriteDetails(bool skipLog);
 
+	void storeKeyframe(uint32 frameNum);
+	uint32 restoreKeyframe(uint32 frameNum);
+	void clearKeyframes();
+
 	BehaviorElement loadSpriteBehavior(Common::MemoryReadStreamEndian *stream, bool skipLog);
 	SpriteInfo loadSpriteInfo(int spriteId, bool skipLog);
 
@@ -207,6 +223,15 @@ public:
 	uint _frameDataOffset = 0;
 	Common::MemoryReadStreamEndian *_framesStream;
 
+	// Keyframes are taken every _keyframeInterval frames while the score
+	// is read, so that jumping backwards does not replay from frame 1.
+	// When they outgrow kKeyframeMemoryBudget, every other one is dropped
+	// and the interval is doubled.
+	Common::Array<ScoreKeyframe> _keyframes;
+	uint _keyframeInterval;
+	uint32 _keyframeMemory;
+	bool _keyframesEnabled;
+
 	byte _currentFrameRate;
 	byte _puppetTempo;
 
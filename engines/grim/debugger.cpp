@@ -27,6 +27,8 @@
 #include "engines/grim/md5check.h"
 #include "engines/grim/grim.h"
 
+#include "engines/grim/lua/luadebug.h"
+
 namespace Grim {
 
 Debugger::Debugger() :
@@ -34,6 +36,7 @@ Debugger::Debugger() :
 
 	registerCmd("check_gamedata", WRAP_METHOD(Debugger, cmd_checkFiles));
 	registerCmd("lua_do", WRAP_METHOD(Debugger, cmd_lua_do));
+	registerCmd("lua_profile", WRAP_METHOD(Debugger, cmd_lua_profile));
 	registerCmd("jump", WRAP_METHOD(Debugger, cmd_jump));
 	registerCmd("renderer_set", WRAP_METHOD(Debugger, cmd_renderer_set));
 	registerCmd("renderer_get", WRAP_METHOD(Debugger, cmd_renderer_get));
@@ -73,6 +76,27 @@ bool Debugger::cmd_lua_do(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmd_lua_profile(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("Usage: lua_profile start|stop|show [entries]\n");
+		return true;
+	}
+
+	Common::String arg = argv[1];
+	if (arg == "start") {
+		lua_startprofile();
+		debugPrintf("Lua profiling started\n");
+	} else if (arg == "stop") {
+		lua_stopprofile();
+		debugPrintf("%s", lua_profilereport(argc > 2 ? atoi(argv[2]) : 20).c_str());
+	} else if (arg == "show") {
+		debugPrintf("%s", lua_profilereport(argc > 2 ? atoi(argv[2]) : 20).c_str());
+	} else {
+		debugPrintf("Usage: lua_profile start|stop|show [entries]\n");
+	}
+	return true;
+}
+
 bool Debugger::cmd_jump(int argc, const char **argv) {
 	if (argc < 2) {
 		debugPrintf("Usage: jump <jump target>\n");
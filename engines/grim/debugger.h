@@ -35,6 +35,7 @@ public:
 
 	bool cmd_checkFiles(int argc, const char **argv);
 	bool cmd_lua_do(int argc, const char **argv);
+	bool cmd_lua_profile(int argc, const char **argv);
 	bool cmd_jump(int argc, const char **argv);
 	bool cmd_renderer_get(int argc, const char **argv);
 	bool cmd_renderer_set(int argc, const char **argv);
@@ -45,6 +45,7 @@ static const DebugChannelDef debugFlagList[] = {
 	{Grim::Debug::Patchr, "patchr", ""},
 	{Grim::Debug::Lipsync, "lipsync", ""},
 	{Grim::Debug::Sprites, "sprites", ""},
+	{Grim::Debug::Renderer, "renderer", ""},
 	DEBUG_CHANNEL_END
 };
 
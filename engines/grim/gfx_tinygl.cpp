@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/config-manager.h"
 #include "common/endian.h"
 #include "common/system.h"
@@ -30,6 +31,7 @@
 
 #include "engines/grim/actor.h"
 #include "engines/grim/colormap.h"
+#include "engines/grim/debug.h"
 #include "engines/grim/material.h"
 #include "engines/grim/font.h"
 #include "engines/grim/gfx_tinygl.h"
@@ -50,7 +52,8 @@ GfxBase *CreateGfxTinyGL() {
 GfxTinyGL::GfxTinyGL() :
 		_alpha(1.f),
 		_currentActor(nullptr), _smushImage(nullptr),
-		_storedDisplay(nullptr) {
+		_storedDisplay(nullptr), _statFrames(0), _statFaces(0),
+		_statDrawCalls(0), _statPresentTime(0), _statStartTime(0) {
 	type = Graphics::RendererType::kRendererTypeTinyGL;
 	// TGL_LEQUAL as tglDepthFunc ensures that subsequent drawing attempts for
 	// the same triangles are not ignored by the depth test.
@@ -182,8 +185,22 @@ void GfxTinyGL::flipBuffer(bool opportunistic) {
 		return;
 	}
 
+	uint32 presentStart = g_system->getMillis();
 	Common::List<Common::Rect> dirtyAreas;
 	TinyGL::presentBuffer(dirtyAreas);
+	uint32 now = g_system->getMillis();
+	_statPresentTime += now - presentStart;
+	_statFrames++;
+	if (now - _statStartTime >= 1000) {
+		Debug::debug(Debug::Renderer, "TinyGL: %u frames, %.2f ms/frame, %.2f ms/frame presenting, %u faces in %u draw calls per frame",
+		             _statFrames, (double)(now - _statStartTime) / _statFrames, (double)_statPresentTime / _statFrames,
+		             _statFaces / _statFrames, _statDrawCalls / _statFrames);
+		_statFrames = 0;
+		_statFaces = 0;
+		_statDrawCalls = 0;
+		_statPresentTime = 0;
+		_statStartTime = now;
+	}
 
 	Graphics::Surface glBuffer;
 	TinyGL::getSurfaceRef(glBuffer);
@@ -695,14 +712,25 @@ void GfxTinyGL::drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face)
 void GfxTinyGL::drawModelFace(const Mesh *mesh, const MeshFace *face) {
 	// Support transparency in actor objects, such as the message tube
 	// in Manny's Office
-	float *vertices = mesh->_vertices;
-	float *vertNormals = mesh->_vertNormals;
-	float *textureVerts = mesh->_textureVerts;
 	tglAlphaFunc(TGL_GREATER, 0.5);
 	tglEnable(TGL_ALPHA_TEST);
 	tglNormal3fv(const_cast<float *>(face->getNormal().getData()));
 	tglBegin(TGL_POLYGON);
-	for (int i = 0; i < face->getNumVertices(); i++) {
+	drawFaceVertices(mesh, face, false);
+	tglEnd();
+	// Done with transparency-capable objects
+	tglDisable(TGL_ALPHA_TEST);
+}
+
+void GfxTinyGL::drawFaceVertices(const Mesh *mesh, const MeshFace *face, bool triangle) {
+	// TGL_POLYGON rasterizes a triangle as (v2, v0, v1); keep that winding
+	// when the face goes into a TGL_TRIANGLES batch instead.
+	static const int polygonOrder[] = { 2, 0, 1 };
+	float *vertices = mesh->_vertices;
+	float *vertNormals = mesh->_vertNormals;
+	float *textureVerts = mesh->_textureVerts;
+	for (int j = 0; j < face->getNumVertices(); j++) {
+		int i = triangle ? polygonOrder[j] : j;
 		tglNormal3fv(vertNormals + 3 * face->getVertex(i));
 
 		if (face->hasTexture())
@@ -710,8 +738,96 @@ void GfxTinyGL::drawModelFace(const Mesh *mesh, const MeshFace *face) {
 
 		tglVertex3fv(vertices + 3 * face->getVertex(i));
 	}
-	tglEnd();
-	// Done with transparency-capable objects
+}
+
+void GfxTinyGL::drawMesh(const Mesh *mesh) {
+	// Blended faces depend on the order they are drawn in
+	if (_alpha < 1.f) {
+		GfxBase::drawMesh(mesh);
+		_statFaces += mesh->_numFaces;
+		_statDrawCalls += mesh->_numFaces;
+		return;
+	}
+
+	// MeshFace::draw() turns the lights off around unlit faces and back on
+	// afterwards, so a lit face uses the incoming lighting state until the
+	// first unlit face and the lights on after it. Sort the faces into those
+	// three passes and by material within a pass, so that every batch needs
+	// one material select and its triangles fit in a single draw call.
+	// Materials are ordered by their first face and faces keep mesh order
+	// within a batch, so coplanar faces resolve their depth ties like the
+	// per-face path whenever materials don't interleave.
+	enum { kPassIncoming, kPassLit, kPassUnlit };
+	const bool toggleLights = !isShadowModeActive();
+	bool seenUnlit = false;
+	_meshBatch.resize(mesh->_numFaces);
+	_meshMaterials.clear();
+	for (int i = 0; i < mesh->_numFaces; i++) {
+		const MeshFace *face = &mesh->_faces[i];
+		MeshBatchFace &entry = _meshBatch[i];
+		entry.pass = kPassIncoming;
+		if (toggleLights && face->getLight() == 0) {
+			entry.pass = kPassUnlit;
+			seenUnlit = true;
+		} else if (seenUnlit) {
+			entry.pass = kPassLit;
+		}
+		entry.materialOrder = 0;
+		while (entry.materialOrder < (int)_meshMaterials.size() && _meshMaterials[entry.materialOrder] != face->getMaterial())
+			entry.materialOrder++;
+		if (entry.materialOrder == (int)_meshMaterials.size())
+			_meshMaterials.push_back(face->getMaterial());
+		entry.index = i;
+	}
+	Common::sort(_meshBatch.begin(), _meshBatch.end(), [](const MeshBatchFace &a, const MeshBatchFace &b) {
+		if (a.pass != b.pass)
+			return a.pass < b.pass;
+		if (a.materialOrder != b.materialOrder)
+			return a.materialOrder < b.materialOrder;
+		return a.index < b.index;
+	});
+
+	tglAlphaFunc(TGL_GREATER, 0.5);
+	tglEnable(TGL_ALPHA_TEST);
+	int pass = kPassIncoming;
+	for (uint i = 0; i < _meshBatch.size();) {
+		const int materialOrder = _meshBatch[i].materialOrder;
+		if (_meshBatch[i].pass != pass) {
+			pass = _meshBatch[i].pass;
+			if (pass == kPassLit)
+				enableLights();
+			else
+				disableLights();
+		}
+		_meshMaterials[materialOrder]->select();
+
+		bool inTriangles = false;
+		for (; i < _meshBatch.size() && _meshBatch[i].pass == pass && _meshBatch[i].materialOrder == materialOrder; i++) {
+			const MeshFace *face = &mesh->_faces[_meshBatch[i].index];
+			if (face->getNumVertices() == 3) {
+				if (!inTriangles) {
+					tglBegin(TGL_TRIANGLES);
+					inTriangles = true;
+					_statDrawCalls++;
+				}
+				drawFaceVertices(mesh, face, true);
+			} else {
+				if (inTriangles) {
+					tglEnd();
+					inTriangles = false;
+				}
+				tglBegin(TGL_POLYGON);
+				drawFaceVertices(mesh, face, false);
+				tglEnd();
+				_statDrawCalls++;
+			}
+			_statFaces++;
+		}
+		if (inTriangles)
+			tglEnd();
+	}
+	if (seenUnlit)
+		enableLights();
 	tglDisable(TGL_ALPHA_TEST);
 }
 
@@ -82,6 +82,7 @@ public:
 
 	void drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face) override;
 	void drawModelFace(const Mesh *mesh, const MeshFace *face) override;
+	void drawMesh(const Mesh *mesh) override;
 	void drawSprite(const Sprite *sprite) override;
 
 	void enableLights() override;
@@ -139,6 +140,23 @@ private:
 	const Actor *_currentActor;
 	TGLenum _depthFunc;
 
+	// drawMesh() scratch list of faces, sorted into batches
+	struct MeshBatchFace {
+		int pass;
+		int materialOrder; // order in which the face's material first appears
+		int index;
+	};
+	Common::Array<MeshBatchFace> _meshBatch;
+	Common::Array<const Material *> _meshMaterials;
+	void drawFaceVertices(const Mesh *mesh, const MeshFace *face, bool triangle);
+
+	// frame statistics, reported once a second on the "renderer" debug channel
+	uint32 _statFrames;
+	uint32 _statFaces;
+	uint32 _statDrawCalls;
+	uint32 _statPresentTime;
+	uint32 _statStartTime;
+
 	void readPixels(int x, int y, int width, int height, uint8 *buffer);
 };
 
@@ -136,6 +136,8 @@ static StkId callC(lua_CFunction f, StkId base) {
 	CS->base = base + numarg;  // == top - stack
 	if (lua_callhook)
 		luaD_callHook(base, nullptr, 0);
+	if (lua_profiling)
+		lua_profiling->cfuncs[(uintptr)f]++;
 	lua_state->callLevelCounter++;
 	(*f)();  // do the actual call
 	lua_state->callLevelCounter--;
@@ -172,7 +174,7 @@ void luaD_callTM(TObject *f, int32 nParams, int32 nResults) {
 int32 luaD_call(StkId base, int32 nResults) {
 	lua_Task *tmpTask = lua_state->task;
 	if (!lua_state->task || lua_state->callLevelCounter) {
-		lua_Task *t = luaM_new(lua_Task);
+		lua_Task *t = lua_newtask();
 		lua_taskinit(t, lua_state->task, base, nResults);
 		lua_state->task = t;
 	} else {
@@ -242,7 +244,7 @@ int32 luaD_call(StkId base, int32 nResults) {
 		if (firstResult <= 0) {
 			nResults = lua_state->task->aux;
 			base = -firstResult;
-			lua_Task *t = luaM_new(lua_Task);
+			lua_Task *t = lua_newtask();
 			lua_taskinit(t, lua_state->task, base, nResults);
 			lua_state->task = t;
 		} else {
@@ -258,7 +260,7 @@ int32 luaD_call(StkId base, int32 nResults) {
 
 			lua_Task *tmp = lua_state->task;
 			lua_state->task = lua_state->task->next;
-			luaM_free(tmp);
+			lua_freetask(tmp);
 			if (lua_state->task) {
 				nResults = lua_state->task->initResults;
 				base = lua_state->task->initBase;
@@ -348,7 +350,7 @@ int32 luaD_protectedrun(int32 nResults) {
 		while (tmpTask != lua_state->task) {
 			lua_Task *t = lua_state->task;
 			lua_state->task = lua_state->task->next;
-			luaM_free(t);
+			lua_freetask(t);
 		}
 		status = 1;
 	}
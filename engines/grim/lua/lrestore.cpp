@@ -473,10 +473,10 @@ void lua_Restore(SaveGame *savedState) {
 			lua_Task *task = nullptr;
 			for (i = 0; i < countTasks; i++) {
 				if (i == 0) {
-					task = state->task = luaM_new(lua_Task);
+					task = state->task = lua_newtask();
 					lua_taskinit(task, nullptr, 0, 0);
 				} else {
-					lua_Task *t = luaM_new(lua_Task);
+					lua_Task *t = lua_newtask();
 					lua_taskinit(t, nullptr, 0, 0);
 					task->next = t;
 					task = t;
@@ -31,6 +31,7 @@
 #include "engines/grim/lua/ltm.h"
 #include "engines/grim/lua/lualib.h"
 #include "engines/grim/lua/luadebug.h"
+#include "engines/grim/lua/lvm.h"
 
 namespace Grim {
 
@@ -109,7 +110,7 @@ void lua_statedeinit(LState *state) {
 		lua_Task *t, *m;
 		for (t = state->task; t != nullptr;) {
 			m = t->next;
-			luaM_free(t);
+			lua_freetask(t);
 			t = m;
 		}
 	}
@@ -239,6 +240,8 @@ void lua_close() {
 		luaM_free(state);
 		state = tmpState;
 	}
+	lua_freetaskpool();
+	luaV_freeprofile();
 
 	Mbuffer = nullptr;
 	IMtable = nullptr;
@@ -158,6 +158,32 @@ TObject *luaH_get(Hash *t, TObject *r) {
 		return nullptr;
 }
 
+/*
+** Same as luaH_get for a string key: strings are interned, so the probe only
+** needs a pointer compare instead of going through luaO_equalObj.
+*/
+TObject *luaH_getstr(Hash *t, TaggedString *key) {
+	int32 tsize = nhash(t);
+	intptr h = (intptr)key;
+	if (h < 0)
+		h = -(h + 1);
+	int32 h1 = int32(h % tsize);
+	Node *n = node(t, h1);
+	if (ttype(ref(n)) != LUA_T_NIL && !(ttype(ref(n)) == LUA_T_STRING && tsvalue(ref(n)) == key)) {
+		int32 h2 = int32(h % (tsize - 2) + 1);
+		do {
+			h1 += h2;
+			if (h1 >= tsize)
+				h1 -= tsize;
+			n = node(t, h1);
+		} while (ttype(ref(n)) != LUA_T_NIL && !(ttype(ref(n)) == LUA_T_STRING && tsvalue(ref(n)) == key));
+	}
+	if (ttype(ref(n)) != LUA_T_NIL)
+		return val(n);
+	else
+		return nullptr;
+}
+
 /*
 ** If the hash node is present, return its pointer, otherwise create a luaM_new
 ** node for the given reference and also return its pointer.
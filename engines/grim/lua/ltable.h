@@ -18,6 +18,7 @@ namespace Grim {
 Hash *luaH_new(int32 nhash);
 void luaH_free(Hash *frees);
 TObject *luaH_get(Hash *t, TObject *r);
+TObject *luaH_getstr(Hash *t, TaggedString *key);
 TObject *luaH_set(Hash *t, TObject *r);
 Node *luaH_next(TObject *o, TObject *r);
 Node *hashnodecreate(int32 nhash);
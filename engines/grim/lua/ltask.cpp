@@ -13,6 +13,41 @@
 
 namespace Grim {
 
+// every Lua call gets a lua_Task frame, so keep released ones around
+#define TASK_POOL_SIZE 64
+
+static lua_Task *taskPool = nullptr;
+static int32 taskPoolCount = 0;
+
+lua_Task *lua_newtask() {
+	if (taskPool) {
+		lua_Task *t = taskPool;
+		taskPool = t->next;
+		taskPoolCount--;
+		return t;
+	}
+	return luaM_new(lua_Task);
+}
+
+void lua_freetask(lua_Task *task) {
+	if (taskPoolCount >= TASK_POOL_SIZE) {
+		luaM_free(task);
+		return;
+	}
+	task->next = taskPool;
+	taskPool = task;
+	taskPoolCount++;
+}
+
+void lua_freetaskpool() {
+	while (taskPool) {
+		lua_Task *t = taskPool;
+		taskPool = t->next;
+		luaM_free(t);
+	}
+	taskPoolCount = 0;
+}
+
 void lua_taskinit(lua_Task *task, lua_Task *next, StkId tbase, int results) {
 	task->executed = false;
 	task->next = next;
@@ -334,7 +369,7 @@ void runtasks(LState *const rootState) {
 				lua_Task *t, *m;
 				for (t = lua_state->task; t != nullptr;) {
 					m = t->next;
-					luaM_free(t);
+					lua_freetask(t);
 					t = m;
 				}
 				stillRunning = false;
@@ -21,6 +21,10 @@ struct lua_Task {
 	int32 initResults;
 };
 
+lua_Task *lua_newtask();
+void lua_freetask(lua_Task *task);
+void lua_freetaskpool();
+
 void lua_taskinit(lua_Task *task, lua_Task *next, StkId tbase, int results);
 void lua_taskresume(lua_Task *task, Closure *closure, TProtoFunc *protofunc, StkId tbase);
 StkId luaV_execute(lua_Task *task);
@@ -25,6 +25,10 @@ const char *lua_getobjname(lua_Object o, const char **name);
 lua_Object lua_getlocal(lua_Function func, int32 local_number, char **name);
 int32 lua_setlocal(lua_Function func, int32 local_number);
 
+void lua_startprofile();
+void lua_stopprofile();
+Common::String lua_profilereport(int32 maxEntries);
+
 extern lua_LHFunction lua_linehook;
 extern lua_CHFunction lua_callhook;
 extern int32 lua_debug;
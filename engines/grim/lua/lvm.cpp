@@ -22,6 +22,9 @@
 #include "engines/grim/lua/luadebug.h"
 #include "engines/grim/lua/lvm.h"
 
+#include "common/algorithm.h"
+#include "common/system.h"
+
 namespace Grim {
 
 #define skip_word(pc)   (pc += 2)
@@ -94,7 +97,8 @@ void luaV_gettable() {
 		int32 tg = (S->top - 2)->value.a->htag;
 		im = luaT_getim(tg, IM_GETTABLE);
 		if (ttype(im) == LUA_T_NIL) {  // and does not have a "gettable" method
-			TObject *h = luaH_get(avalue(S->top - 2), S->top - 1);
+			TObject *key = S->top - 1;
+			TObject *h = ttype(key) == LUA_T_STRING ? luaH_getstr(avalue(S->top - 2), tsvalue(key)) : luaH_get(avalue(S->top - 2), key);
 			if (h && ttype(h) != LUA_T_NIL) {
 				--S->top;
 				*(S->top - 1) = *h;
@@ -259,6 +263,8 @@ StkId luaV_execute(lua_Task *task) {
 	lua_state->callLevelCounter++;
 
 	while (1) {
+		if (lua_profiling)
+			lua_profiling->opcodes[*task->pc]++;
 		switch ((OpCode)(task->aux = *task->pc++)) {
 		case PUSHNIL0:
 			ttype(task->S->top++) = LUA_T_NIL;
@@ -692,4 +698,81 @@ setline:
 	}
 }
 
+LuaProfile *lua_profiling = nullptr;
+static LuaProfile *lastProfile = nullptr;
+
+void lua_startprofile() {
+	luaV_freeprofile();
+	lastProfile = new LuaProfile();
+	memset(lastProfile->opcodes, 0, sizeof(lastProfile->opcodes));
+	lastProfile->startTime = g_system->getMillis();
+	lastProfile->stopTime = 0;
+	lua_profiling = lastProfile;
+}
+
+void lua_stopprofile() {
+	if (lua_profiling) {
+		lua_profiling->stopTime = g_system->getMillis();
+		lua_profiling = nullptr;
+	}
+}
+
+void luaV_freeprofile() {
+	lua_profiling = nullptr;
+	delete lastProfile;
+	lastProfile = nullptr;
+}
+
+static const char *cfuncname(uintptr f) {
+	for (GCnode *g = rootglobal.next; g; g = g->next) {
+		TaggedString *s = (TaggedString *)g;
+		if (ttype(&s->globalval) == LUA_T_CPROTO && (uintptr)fvalue(&s->globalval) == f)
+			return s->str;
+	}
+	return nullptr;
+}
+
+Common::String lua_profilereport(int32 maxEntries) {
+	if (!lastProfile)
+		return "No profile recorded\n";
+
+	uint32 elapsed = (lastProfile->stopTime ? lastProfile->stopTime : g_system->getMillis()) - lastProfile->startTime;
+	uint32 ops = 0;
+	Common::Array<Common::Pair<uint32, uint32> > opcodes;
+	for (int32 i = 0; i < 256; i++) {
+		if (lastProfile->opcodes[i]) {
+			ops += lastProfile->opcodes[i];
+			opcodes.push_back(Common::Pair<uint32, uint32>(lastProfile->opcodes[i], i));
+		}
+	}
+	Common::Array<Common::Pair<uint32, uintptr> > cfuncs;
+	uint32 calls = 0;
+	for (Common::HashMap<uintptr, uint32>::const_iterator it = lastProfile->cfuncs.begin(); it != lastProfile->cfuncs.end(); ++it) {
+		calls += it->_value;
+		cfuncs.push_back(Common::Pair<uint32, uintptr>(it->_value, it->_key));
+	}
+	Common::sort(opcodes.begin(), opcodes.end(), [](const Common::Pair<uint32, uint32> &a, const Common::Pair<uint32, uint32> &b) {
+		return a.first > b.first;
+	});
+	Common::sort(cfuncs.begin(), cfuncs.end(), [](const Common::Pair<uint32, uintptr> &a, const Common::Pair<uint32, uintptr> &b) {
+		return a.first > b.first;
+	});
+
+	Common::String report = Common::String::format("%u ms%s, %u opcodes (%u/s), %u C calls (%u/s)\n",
+		elapsed, lua_profiling ? " (running)" : "", ops, elapsed ? (uint32)((uint64)ops * 1000 / elapsed) : 0,
+		calls, elapsed ? (uint32)((uint64)calls * 1000 / elapsed) : 0);
+	report += "Opcodes (see lopcodes.h):\n";
+	for (uint32 i = 0; i < opcodes.size() && (int32)i < maxEntries; i++)
+		report += Common::String::format("  %3u: %10u\n", opcodes[i].second, opcodes[i].first);
+	report += "C functions:\n";
+	for (uint32 i = 0; i < cfuncs.size() && (int32)i < maxEntries; i++) {
+		const char *name = cfuncname(cfuncs[i].second);
+		if (name)
+			report += Common::String::format("  %-30s %10u\n", name, cfuncs[i].first);
+		else
+			report += Common::String::format("  %-30p %10u\n", (void *)cfuncs[i].second, cfuncs[i].first);
+	}
+	return report;
+}
+
 } // end of namespace Grim
@@ -10,6 +10,8 @@
 #include "engines/grim/lua/ldo.h"
 #include "engines/grim/lua/lobject.h"
 
+#include "common/hashmap.h"
+
 namespace Grim {
 
 #define tonumber(o) ((ttype(o) != LUA_T_NUMBER) && (luaV_tonumber(o) != 0))
@@ -25,6 +27,21 @@ void luaV_getglobal(TaggedString *ts);
 void luaV_setglobal(TaggedString *ts);
 void luaV_closure(int32 nelems);
 
+/*
+** Opcode and C function call counters, filled in while a profile is running
+** (see the "lua_profile" debugger command).
+*/
+struct LuaProfile {
+	uint32 startTime;
+	uint32 stopTime;
+	uint32 opcodes[256];
+	Common::HashMap<uintptr, uint32> cfuncs;
+};
+
+extern LuaProfile *lua_profiling;
+
+void luaV_freeprofile();
+
 } // end of namespace Grim
 
 #endif
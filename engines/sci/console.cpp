@@ -54,6 +54,7 @@
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
 #include "common/memstream.h"
+#include "sci/graphics/celobj32.h"
 #include "sci/graphics/frameout.h"
 #include "sci/graphics/paint32.h"
 #include "sci/graphics/palette32.h"
@@ -95,11 +96,14 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("opcodes",			WRAP_METHOD(Console, cmdOpcodes));
 	registerCmd("selector",			WRAP_METHOD(Console, cmdSelector));
 	registerCmd("selectors",			WRAP_METHOD(Console, cmdSelectors));
+	registerCmd("selector_cache",		WRAP_METHOD(Console, cmdSelectorCache));
 	registerCmd("kernfunctions",		WRAP_METHOD(Console, cmdKernelFunctions));
 	registerCmd("functions",		WRAP_METHOD(Console, cmdKernelFunctions));	// alias
 	registerCmd("kerncall", 		WRAP_METHOD(Console, cmdKernelCall));
 	registerCmd("kc",				WRAP_METHOD(Console, cmdKernelCall));	// alias
 	registerCmd("class_table",		WRAP_METHOD(Console, cmdClassTable));
+	registerCmd("path_stats",		WRAP_METHOD(Console, cmdPathStats));
+	registerCmd("path_replay",		WRAP_METHOD(Console, cmdPathReplay));
 	// Parser
 	registerCmd("suffixes",			WRAP_METHOD(Console, cmdSuffixes));
 	registerCmd("parse_grammar",		WRAP_METHOD(Console, cmdParseGrammar));
@@ -150,6 +154,8 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
+	registerCmd("cel_cache",          WRAP_METHOD(Console, cmdCelCache));
+	registerCmd("frame_stats",        WRAP_METHOD(Console, cmdFrameStats));
 	// Segments
 	registerCmd("segment_table",		WRAP_METHOD(Console, cmdPrintSegmentTable));
 	registerCmd("segtable",			WRAP_METHOD(Console, cmdPrintSegmentTable));	// alias
@@ -163,6 +169,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -336,8 +343,11 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" opcodes - Lists the opcode names\n");
 	debugPrintf(" selectors - Lists the selector names\n");
 	debugPrintf(" selector - Attempts to find the requested selector by name\n");
+	debugPrintf(" selector_cache - Shows the statistics of the selector lookup cache\n");
 	debugPrintf(" functions - Lists the kernel functions\n");
 	debugPrintf(" class_table - Shows the available classes\n");
+	debugPrintf(" path_stats - Shows the statistics of the pathfinder\n");
+	debugPrintf(" path_replay - Replays and times the most recent pathfinding requests\n");
 	debugPrintf("\n");
 	debugPrintf("Parser:\n");
 	debugPrintf(" suffixes - Lists the vocabulary suffixes\n");
@@ -386,6 +396,8 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
+	debugPrintf(" cel_cache - Shows the statistics of the cel cache, or sets its size (SCI2+)\n");
+	debugPrintf(" frame_stats - Shows how long rendering frames took (SCI2+)\n");
 	debugPrintf("\n");
 	debugPrintf("Segments:\n");
 	debugPrintf(" segment_table / segtable - Lists all segments\n");
@@ -398,6 +410,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows the statistics of the garbage collector\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -573,6 +586,107 @@ bool Console::cmdSelector(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdSelectorCache(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && scumm_stricmp(argv[1], "reset"))) {
+		debugPrintf("Shows the statistics of the selector lookup cache.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	SelectorLookupCache &cache = _engine->_gamestate->_segMan->getSelectorLookupCache();
+
+	if (argc == 2) {
+		cache.resetStats();
+		debugPrintf("Selector cache statistics reset\n");
+		return true;
+	}
+
+	const uint32 lookups = cache.getHits() + cache.getMisses();
+	debugPrintf("Cached selectors: %d\n", cache.size());
+	debugPrintf("Lookups: %d, hits: %d, misses: %d\n", lookups, cache.getHits(), cache.getMisses());
+	if (lookups)
+		debugPrintf("Hit rate: %d.%02d%%\n", (int)((uint64)cache.getHits() * 100 / lookups), (int)((uint64)cache.getHits() * 10000 / lookups % 100));
+	debugPrintf("Flushes: %d\n", cache.getFlushes());
+
+	return true;
+}
+
+bool Console::cmdPathStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && scumm_stricmp(argv[1], "reset"))) {
+		debugPrintf("Shows the statistics of the pathfinder (kAvoidPath).\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	PathfindingStatistics &stats = _engine->_gamestate->pathfindingStats;
+
+	if (argc == 2) {
+		stats.reset();
+		debugPrintf("Pathfinder statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("Pathfinding requests: %d\n", stats.queries);
+	debugPrintf("Visibility graphs: %d cached, hits: %d, misses: %d, bypassed: %d\n",
+		_engine->_gamestate->pathfindingGraphs.size(), stats.graphHits, stats.graphMisses, stats.graphBypassed);
+	debugPrintf("Visible vertex lists: %d computed, %d reused\n", stats.listsComputed, stats.listsReused);
+	debugPrintf("Times (in milliseconds): last %d, max %d, total %d\n", stats.lastTime, stats.maxTime, stats.totalTime);
+
+	return true;
+}
+
+bool Console::cmdPathReplay(int argc, const char **argv) {
+	int iterations = 10;
+
+	if (argc > 2 || (argc == 2 && (!parseInteger(argv[1], iterations) || iterations <= 0))) {
+		debugPrintf("Replays the most recent pathfinding requests, with and without the\n");
+		debugPrintf("cached visibility graphs, and compares the results and timings.\n");
+		debugPrintf("Requests are recorded while the Pathfinding debug channel is enabled.\n");
+		debugPrintf("Usage: %s [<iterations>]\n", argv[0]);
+		debugPrintf("<iterations> is the number of times each request is run, 10 by default\n");
+		return true;
+	}
+
+	EngineState *s = _engine->_gamestate;
+
+	if (s->pathfindingInputs.empty()) {
+		debugPrintf("No pathfinding requests have been recorded\n");
+		debugPrintf("Requests are only recorded while the Pathfinding debug channel is enabled\n");
+		return true;
+	}
+
+	uint32 totalUncached = 0, totalCached = 0;
+	int index = 0;
+
+	for (Common::List<PathfindingInput>::const_iterator it = s->pathfindingInputs.begin(); it != s->pathfindingInputs.end(); ++it, ++index) {
+		const PathfindingInput &input = *it;
+		Common::Array<Common::Point> uncachedPath, cachedPath;
+		bool success = true;
+
+		uint32 startTime = g_system->getMillis();
+		for (int i = 0; i < iterations; i++)
+			success &= replayPathfindingInput(s, input, false, uncachedPath);
+		const uint32 uncachedTime = g_system->getMillis() - startTime;
+
+		startTime = g_system->getMillis();
+		for (int i = 0; i < iterations; i++)
+			success &= replayPathfindingInput(s, input, true, cachedPath);
+		const uint32 cachedTime = g_system->getMillis() - startTime;
+
+		totalUncached += uncachedTime;
+		totalCached += cachedTime;
+
+		debugPrintf("%2d: (%d, %d) -> (%d, %d), %d polygons, %d vertices: uncached %d ms, cached %d ms%s\n",
+			index, input.start.x, input.start.y, input.end.x, input.end.y,
+			input.polygonSizes.size(), input.points.size(), uncachedTime, cachedTime,
+			!success ? ", FAILED" : (uncachedPath != cachedPath ? ", PATHS DIFFER" : ""));
+	}
+
+	debugPrintf("Total: uncached %d ms, cached %d ms\n", totalUncached, totalCached);
+
+	return true;
+}
+
 bool Console::cmdSelectors(int argc, const char **argv) {
 	debugPrintf("Selector names in numeric order:\n");
 	Common::String selectorName;
@@ -2407,6 +2521,63 @@ bool Console::cmdShowSavedBits(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdCelCache(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (argc > 3 || (argc == 2 && scumm_stricmp(argv[1], "reset")) || (argc == 3 && scumm_stricmp(argv[1], "size"))) {
+		debugPrintf("Shows the statistics of the cel cache, resets them, or sets the size of the cache.\n");
+		debugPrintf("Usage: %s [reset | size <kilobytes>]\n", argv[0]);
+		return true;
+	}
+
+	if (!_engine->_gfxFrameout || !CelObj::_cache) {
+		debugPrintf("This SCI version does not have a cel cache\n");
+		return true;
+	}
+
+	CelCache &cache = *CelObj::_cache;
+
+	if (argc == 2) {
+		cache.resetStats();
+		debugPrintf("Cel cache statistics reset\n");
+		return true;
+	} else if (argc == 3) {
+		cache.setBudget(atoi(argv[2]) * 1024);
+	}
+
+	debugPrintf("Cached cels: %d, using %d of %d KB\n", cache.size(), cache.getUsage() / 1024, cache.getBudget() / 1024);
+	debugPrintf("Cel lookups: %d hits, %d misses\n", cache.getHits(), cache.getMisses());
+	debugPrintf("Pixel lookups: %d hits, %d misses\n", cache.getPixelHits(), cache.getPixelMisses());
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
+bool Console::cmdFrameStats(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (argc > 2 || (argc == 2 && scumm_stricmp(argv[1], "reset"))) {
+		debugPrintf("Shows how long rendering frames took, or resets the statistics.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (!_engine->_gfxFrameout) {
+		debugPrintf("This SCI version does not have frame statistics\n");
+		return true;
+	}
+
+	if (argc == 2) {
+		_engine->_gfxFrameout->resetFrameOutStats();
+		debugPrintf("Frame statistics reset\n");
+	} else {
+		_engine->_gfxFrameout->printFrameOutStats(this);
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 
 bool Console::cmdParseGrammar(int argc, const char **argv) {
 	debugPrintf("Parse grammar, in strict GNF:\n");
@@ -2934,6 +3105,30 @@ bool Console::cmdGCNormalize(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && scumm_stricmp(argv[1], "reset"))) {
+		debugPrintf("Shows the statistics of the garbage collector.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	GCStatistics &stats = _engine->_gamestate->gcStats;
+
+	if (argc == 2) {
+		stats.reset();
+		debugPrintf("Garbage collector statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("Collections: %d, skipped: %d\n", stats.runs, stats.skipped);
+	debugPrintf("Objects freed: %d\n", stats.freed);
+	debugPrintf("Pause times (in milliseconds): last %d, max %d, total %d\n", stats.lastPause, stats.maxPause, stats.totalPause);
+	if (stats.runs)
+		debugPrintf("Average pause: %d ms\n", stats.totalPause / stats.runs);
+
+	return true;
+}
+
 bool Console::cmdVMVarlist(int argc, const char **argv) {
 	EngineState *s = _engine->_gamestate;
 	const char *varnames[] = {"global", "local", "temp", "param"};
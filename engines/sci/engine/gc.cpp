@@ -21,6 +21,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -178,9 +179,20 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 	return normalizeAddresses(s->_segMan, wm._map);
 }
 
-void run_gc(EngineState *s) {
+void run_gc(EngineState *s, bool periodic) {
 	SegManager *segMan = s->_segMan;
 
+	// Without any allocation since the last collection the heap can't have
+	// grown, so there is no need to go through all of it again. Objects that
+	// became unreachable in the meantime are freed by the next collection.
+	if (periodic && segMan->getAllocationCount() == s->gcAllocationCount) {
+		s->gcStats.skipped++;
+		return;
+	}
+
+	const uint32 startTime = g_system->getMillis();
+	uint32 freed = 0;
+
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
 #ifdef GC_DEBUG_CODE
@@ -213,6 +225,7 @@ void run_gc(EngineState *s) {
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					freed++;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -225,6 +238,17 @@ void run_gc(EngineState *s) {
 
 	delete activeRefs;
 
+	s->gcAllocationCount = segMan->getAllocationCount();
+
+	const uint32 pause = g_system->getMillis() - startTime;
+	GCStatistics &stats = s->gcStats;
+	stats.runs++;
+	stats.freed += freed;
+	stats.lastPause = pause;
+	stats.maxPause = MAX(stats.maxPause, pause);
+	stats.totalPause += pause;
+	debugC(kDebugLevelGC, "[GC] Freed %d objects in %d ms", freed, pause);
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
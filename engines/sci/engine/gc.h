@@ -51,8 +51,10 @@ AddrSet *findAllActiveReferences(EngineState *s);
 /**
  * Runs garbage collection on the current system state
  * @param s The state in which we should gc
+ * @param periodic Whether this is one of the periodic collections of the VM,
+ *                 which is skipped if nothing was allocated since the last one
  */
-void run_gc(EngineState *s);
+void run_gc(EngineState *s, bool periodic = false);
 
 struct WorklistManager {
 	Common::Array<reg_t> _worklist;
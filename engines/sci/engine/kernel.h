@@ -753,6 +753,19 @@ reg_t kScummVMSaveLoad(EngineState *s, int argc, reg_t *argv);
 
 /** @} */
 
+struct PathfindingInput;
+
+/**
+ * Runs the pathfinder on a recorded kAvoidPath input. Used by the debugger to
+ * verify and time the pathfinder.
+ * @param s			the game state
+ * @param input		the recorded input
+ * @param useGraph	whether to use the cached visibility graphs
+ * @param path		the resulting path, as it would be returned to the scripts
+ * @return true on success, false if no path could be computed
+ */
+bool replayPathfindingInput(EngineState *s, const PathfindingInput &input, bool useGraph, Common::Array<Common::Point> &path);
+
 } // End of namespace Sci
 
 #endif // SCI_ENGINE_KERNEL_H
@@ -66,6 +66,12 @@ enum {
 
 #define HUGE_DISTANCE 0xFFFFFFFF
 
+// Number of visibility graphs kept across kAvoidPath calls
+#define MAX_PATHFINDING_GRAPHS 4
+
+// Number of kAvoidPath inputs kept for replaying them in the debugger
+#define MAX_PATHFINDING_INPUTS 16
+
 #define VERTEX_HAS_EDGES(V) ((V) != CLIST_NEXT(V))
 
 // Error codes
@@ -116,10 +122,14 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// Position in the vertex index
+	int index;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = nullptr;
+		index = -1;
 	}
 };
 
@@ -262,6 +272,16 @@ struct PathfindingState {
 	// Screen size
 	int _width, _height;
 
+	// Cached visibility graph of the obstacles, NULL if not used
+	PathfindingGraph *_graph;
+
+	// Position of the first obstacle vertex in the vertex index. The start
+	// and end points precede it, if they were added as separate vertices.
+	int _graphOffset;
+
+	// Statistics to update, NULL if not recorded
+	PathfindingStatistics *_stats;
+
 	PathfindingState(int width, int height) : _width(width), _height(height) {
 		vertex_start = nullptr;
 		vertex_end = nullptr;
@@ -269,6 +289,9 @@ struct PathfindingState {
 		_prependPoint = nullptr;
 		_appendPoint = nullptr;
 		vertices = 0;
+		_graph = nullptr;
+		_graphOffset = 0;
+		_stats = nullptr;
 	}
 
 	~PathfindingState() {
@@ -698,6 +721,39 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+/**
+ * Determines whether a vertex is visible from another vertex.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex to look from
+ * @param vertex		the vertex to look at
+ * @return true if the line between both vertices doesn't cross any polygon
+ */
+static bool vertex_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
@@ -706,37 +762,49 @@ static int inside(const Common::Point &p, Vertex *vertex) {
  */
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
+	const int graphIndex = vertex_cur->index - s->_graphOffset;
 
-	for (int i = 0; i < s->vertices; i++) {
-		Vertex *vertex = s->vertex_index[i];
+	if (!s->_graph || graphIndex < 0) {
+		for (int i = 0; i < s->vertices; i++) {
+			Vertex *vertex = s->vertex_index[i];
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
-			continue;
+			if (vertex_visible(s, vertex_cur, vertex))
+				visVerts->push_front(vertex);
+		}
 
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
+		return visVerts;
+	}
 
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
+	// The visibility between obstacle vertices only depends on the
+	// obstacles, so it's taken from the cached graph. The start and end
+	// points have no edges, so they don't affect it.
+	Common::Array<uint16> &visible = s->_graph->visible[graphIndex];
 
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
-			}
+	if (!s->_graph->computed[graphIndex]) {
+		for (int i = s->_graphOffset; i < s->vertices; i++) {
+			if (vertex_visible(s, vertex_cur, s->vertex_index[i]))
+				visible.push_back(i - s->_graphOffset);
 		}
 
-		if (j == s->vertices)
+		s->_graph->computed[graphIndex] = true;
+		if (s->_stats)
+			s->_stats->listsComputed++;
+	} else if (s->_stats) {
+		s->_stats->listsReused++;
+	}
+
+	// Keep the order of the uncached list, which affects the chosen path
+	// when several paths have the same length
+	for (int i = 0; i < s->_graphOffset; i++) {
+		Vertex *vertex = s->vertex_index[i];
+
+		if (vertex_visible(s, vertex_cur, vertex))
 			visVerts->push_front(vertex);
 	}
 
+	for (uint i = 0; i < visible.size(); i++)
+		visVerts->push_front(s->vertex_index[s->_graphOffset + visible[i]]);
+
 	return visVerts;
 }
 
@@ -1117,9 +1185,10 @@ static Common::Point *fixup_end_point(PathfindingState *s, const Common::Point &
  * the new vertex
  * Parameters: (PathfindingState *) s: The pathfinding state
  *             (const Common::Point &) v: The point to merge
+ *             (bool &) splitEdge: Set to true if an edge was split up
  * Returns   : (Vertex *) The vertex corresponding to v
  */
-static Vertex *merge_point(PathfindingState *s, const Common::Point &v) {
+static Vertex *merge_point(PathfindingState *s, const Common::Point &v, bool &splitEdge) {
 	Vertex *vertex;
 	Vertex *v_new;
 	Polygon *polygon;
@@ -1146,6 +1215,7 @@ static Vertex *merge_point(PathfindingState *s, const Common::Point &v) {
 				if (between(vertex->v, next->v, v)) {
 					// Split edge by adding vertex
 					polygon->vertices.insertAfter(vertex, v_new);
+					splitEdge = true;
 					return v_new;
 				}
 			}
@@ -1236,40 +1306,102 @@ static void change_polygons_opt_0(PathfindingState *s) {
 }
 
 /**
- * Converts the SCI input data for pathfinding
+ * Records the polygon set of a kAvoidPath call, so that it can be replayed in
+ * the debugger. Only called while the Pathfinding debug channel is enabled
  * Parameters: (EngineState *) s: The game state
- *             (reg_t) poly_list: Polygon list
+ *             (PathfindingState *) pf_s: The pathfinding state, containing the
+ *                                        unmodified polygons
  *             (Common::Point) start: The start point
  *             (Common::Point) end: The end point
  *             (int) opt: Optimization level (0, 1 or 2)
- * Returns   : (PathfindingState *) On success a newly allocated pathfinding state,
- *                            NULL otherwise
  */
-static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Common::Point start, Common::Point end, int width, int height, int opt) {
-	SegManager *segMan = s->_segMan;
-	Polygon *polygon;
-	int count = 0;
-	PathfindingState *pf_s = new PathfindingState(width, height);
+static void record_input(EngineState *s, PathfindingState *pf_s, const Common::Point &start, const Common::Point &end, int opt) {
+	PathfindingInput input;
 
-	// Convert all polygons
-	if (poly_list.getSegment()) {
-		List *list = s->_segMan->lookupList(poly_list);
-		Node *node = s->_segMan->lookupNode(list->first);
+	for (PolygonList::iterator it = pf_s->polygons.begin(); it != pf_s->polygons.end(); ++it) {
+		Polygon *polygon = *it;
+		Vertex *vertex;
+		uint size = 0;
 
-		while (node) {
-			// The node value might be null, in which case there's no polygon to parse.
-			// Happens in LB2 floppy - refer to bug #5195
-			polygon = !node->value.isNull() ? convert_polygon(s, node->value) : nullptr;
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			input.points.push_back(vertex->v);
+			size++;
+		}
 
-			if (polygon) {
-				pf_s->polygons.push_back(polygon);
-				count += readSelectorValue(segMan, node->value, SELECTOR(size));
-			}
+		input.polygonTypes.push_back(polygon->type);
+		input.polygonSizes.push_back(size);
+	}
 
-			node = s->_segMan->lookupNode(node->succ);
+	input.start = start;
+	input.end = end;
+	input.width = pf_s->_width;
+	input.height = pf_s->_height;
+	input.opt = opt;
+
+	s->pathfindingInputs.push_back(input);
+	if (s->pathfindingInputs.size() > MAX_PATHFINDING_INPUTS)
+		s->pathfindingInputs.pop_front();
+}
+
+/**
+ * Looks up the cached visibility graph of the obstacles, adding a new one if
+ * there is none
+ * Parameters: (EngineState *) s: The game state
+ *             (const Common::Array<uint> &) polygonSizes: Number of vertices of
+ *                                                         each obstacle
+ *             (const Common::Array<Common::Point> &) points: The vertices of
+ *                                                            all obstacles
+ *             (PathfindingStatistics *) stats: Statistics to update, or NULL
+ * Returns   : (PathfindingGraph *) The visibility graph
+ */
+static PathfindingGraph *find_graph(EngineState *s, const Common::Array<uint> &polygonSizes, const Common::Array<Common::Point> &points, PathfindingStatistics *stats) {
+	Common::List<PathfindingGraph *> &graphs = s->pathfindingGraphs;
+
+	for (Common::List<PathfindingGraph *>::iterator it = graphs.begin(); it != graphs.end(); ++it) {
+		PathfindingGraph *graph = *it;
+
+		if (graph->polygonSizes == polygonSizes && graph->points == points) {
+			// Move to the front of the list, as it's the most recently used one
+			graphs.erase(it);
+			graphs.push_front(graph);
+
+			if (stats)
+				stats->graphHits++;
+			return graph;
 		}
 	}
 
+	if (graphs.size() >= MAX_PATHFINDING_GRAPHS) {
+		delete graphs.back();
+		graphs.pop_back();
+	}
+
+	PathfindingGraph *graph = new PathfindingGraph();
+	graph->polygonSizes = polygonSizes;
+	graph->points = points;
+	graph->visible.resize(points.size());
+	graph->computed.resize(points.size(), false);
+	graphs.push_front(graph);
+
+	if (stats)
+		stats->graphMisses++;
+	return graph;
+}
+
+/**
+ * Prepares a converted polygon set for pathfinding
+ * Parameters: (EngineState *) s: The game state
+ *             (PathfindingState *) pf_s: The pathfinding state, containing the
+ *                                        converted polygons
+ *             (Common::Point) start: The start point
+ *             (Common::Point) end: The end point
+ *             (int) opt: Optimization level (0, 1 or 2)
+ *             (bool) useGraph: Whether to use a cached visibility graph
+ * Returns   : (bool) true on success, false otherwise
+ */
+static bool prepare_polygon_set(EngineState *s, PathfindingState *pf_s, Common::Point start, Common::Point end, int opt, bool useGraph) {
+	Polygon *polygon;
+
 	if (opt == 0)
 		change_polygons_opt_0(pf_s);
 
@@ -1277,8 +1409,7 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 
 	if (!new_start) {
 		warning("AvoidPath: Couldn't fixup start position for pathfinding");
-		delete pf_s;
-		return nullptr;
+		return false;
 	}
 
 	Common::Point *new_end = fixup_end_point(pf_s, end);
@@ -1286,8 +1417,7 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	if (!new_end) {
 		warning("AvoidPath: Couldn't fixup end position for pathfinding");
 		delete new_start;
-		delete pf_s;
-		return nullptr;
+		return false;
 	}
 
 	if (opt == 0) {
@@ -1309,8 +1439,7 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 				warning("AvoidPath: error finding nearest intersection");
 				delete new_start;
 				delete new_end;
-				delete pf_s;
-				return nullptr;
+				return false;
 			}
 
 			if (err == PF_OK)
@@ -1326,15 +1455,39 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		}
 	}
 
+	// Remember the obstacles, before the start and end points are added
+	Common::Array<uint> polygonSizes;
+	Common::Array<Common::Point> points;
+
+	if (useGraph) {
+		for (PolygonList::iterator it = pf_s->polygons.begin(); it != pf_s->polygons.end(); ++it) {
+			Vertex *vertex;
+			uint size = 0;
+
+			CLIST_FOREACH(vertex, &(*it)->vertices) {
+				points.push_back(vertex->v);
+				size++;
+			}
+
+			polygonSizes.push_back(size);
+		}
+	}
+
 	// Merge start and end points into polygon set
-	pf_s->vertex_start = merge_point(pf_s, *new_start);
-	pf_s->vertex_end = merge_point(pf_s, *new_end);
+	bool splitEdge = false;
+	pf_s->vertex_start = merge_point(pf_s, *new_start, splitEdge);
+	pf_s->vertex_end = merge_point(pf_s, *new_end, splitEdge);
 
 	delete new_start;
 	delete new_end;
 
 	// Allocate and build vertex index
-	pf_s->vertex_index = (Vertex**)malloc(sizeof(Vertex *) * (count + 2));
+	int count = 0;
+
+	for (PolygonList::iterator it = pf_s->polygons.begin(); it != pf_s->polygons.end(); ++it)
+		count += (*it)->vertices.size();
+
+	pf_s->vertex_index = (Vertex**)malloc(sizeof(Vertex *) * count);
 
 	count = 0;
 
@@ -1343,12 +1496,72 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		Vertex *vertex;
 
 		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->index = count;
 			pf_s->vertex_index[count++] = vertex;
 		}
 	}
 
 	pf_s->vertices = count;
 
+	if (useGraph) {
+		if (splitEdge) {
+			// The obstacles have been changed, so the cached visibility
+			// doesn't apply to them
+			if (pf_s->_stats)
+				pf_s->_stats->graphBypassed++;
+		} else {
+			// New start and end vertices have been added as single-vertex
+			// polygons in front of the obstacles
+			pf_s->_graph = find_graph(s, polygonSizes, points, pf_s->_stats);
+			pf_s->_graphOffset = count - points.size();
+			assert(pf_s->_graphOffset >= 0 && pf_s->_graphOffset <= 2);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Converts the SCI input data for pathfinding
+ * Parameters: (EngineState *) s: The game state
+ *             (reg_t) poly_list: Polygon list
+ *             (Common::Point) start: The start point
+ *             (Common::Point) end: The end point
+ *             (int) opt: Optimization level (0, 1 or 2)
+ * Returns   : (PathfindingState *) On success a newly allocated pathfinding state,
+ *                            NULL otherwise
+ */
+static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Common::Point start, Common::Point end, int width, int height, int opt) {
+	Polygon *polygon;
+	PathfindingState *pf_s = new PathfindingState(width, height);
+	pf_s->_stats = &s->pathfindingStats;
+
+	// Convert all polygons
+	if (poly_list.getSegment()) {
+		List *list = s->_segMan->lookupList(poly_list);
+		Node *node = s->_segMan->lookupNode(list->first);
+
+		while (node) {
+			// The node value might be null, in which case there's no polygon to parse.
+			// Happens in LB2 floppy - refer to bug #5195
+			polygon = !node->value.isNull() ? convert_polygon(s, node->value) : nullptr;
+
+			if (polygon)
+				pf_s->polygons.push_back(polygon);
+
+			node = s->_segMan->lookupNode(node->succ);
+		}
+	}
+
+	// Only keep inputs for path_replay while pathfinding is being debugged
+	if (DebugMan.isDebugChannelEnabled(kDebugLevelAvoidPath))
+		record_input(s, pf_s, start, end, opt);
+
+	if (!prepare_polygon_set(s, pf_s, start, end, opt, true)) {
+		delete pf_s;
+		return nullptr;
+	}
+
 	return pf_s;
 }
 
@@ -1611,6 +1824,10 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 			}
 		}
 
+		PathfindingStatistics &stats = s->pathfindingStats;
+		const uint32 startTime = g_system->getMillis();
+		stats.queries++;
+
 		PathfindingState *p = convert_polygon_set(s, poly_list, start, end, width, height, opt);
 
 		if (!p) {
@@ -1634,6 +1851,10 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 		output = output_path(p, s);
 		delete p;
 
+		stats.lastTime = g_system->getMillis() - startTime;
+		stats.maxTime = MAX(stats.maxTime, stats.lastTime);
+		stats.totalTime += stats.lastTime;
+
 		// Memory is freed by explicit calls to Memory
 		return output;
 	}
@@ -1644,6 +1865,55 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 	}
 }
 
+bool replayPathfindingInput(EngineState *s, const PathfindingInput &input, bool useGraph, Common::Array<Common::Point> &path) {
+	PathfindingState *p = new PathfindingState(input.width, input.height);
+	uint pos = 0;
+
+	for (uint i = 0; i < input.polygonSizes.size(); i++) {
+		Polygon *polygon = new Polygon(input.polygonTypes[i]);
+
+		for (uint j = 0; j < input.polygonSizes[i]; j++)
+			polygon->vertices.insertAtEnd(new Vertex(input.points[pos++]));
+
+		p->polygons.push_back(polygon);
+	}
+
+	path.clear();
+
+	if (!prepare_polygon_set(s, p, input.start, input.end, input.opt, useGraph)) {
+		delete p;
+		return false;
+	}
+
+	AStar(p);
+
+	// Same points as output_path() returns, in order
+	Vertex *vertex = p->vertex_end;
+
+	if (vertex->path_prev) {
+		if (p->_appendPoint)
+			path.push_back(*p->_appendPoint);
+
+		while (vertex) {
+			path.push_back(vertex->v);
+			vertex = vertex->path_prev;
+		}
+
+		if (p->_prependPoint)
+			path.push_back(*p->_prependPoint);
+	} else {
+		path.push_back(p->vertex_start->v);
+		path.push_back(p->_prependPoint ? *p->_prependPoint : p->vertex_start->v);
+	}
+
+	// The path has been collected from the end point backwards
+	for (uint i = 0; i < path.size() / 2; i++)
+		SWAP(path[i], path[path.size() - 1 - i]);
+
+	delete p;
+	return true;
+}
+
 static bool PointInRect(const Common::Point &point, int16 rectX1, int16 rectY1, int16 rectX2, int16 rectY2) {
 	int16 top = MIN<int16>(rectY1, rectY2);
 	int16 left = MIN<int16>(rectX1, rectX2);
@@ -74,6 +74,9 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_offsetLookupObjectCount = 0;
 	_offsetLookupStringCount = 0;
 	_offsetLookupSaidCount = 0;
+
+	_instructionIndex.clear();
+	_instructions.clear();
 }
 
 enum {
@@ -726,6 +729,25 @@ uint32 Script::getRelocationOffset(const uint32 offset) const {
 	return kNoRelocation;
 }
 
+const PMachineInstruction &Script::decodeInstruction(uint32 offset) {
+	if (offset >= getBufSize())
+		error("Script %d: attempt to decode an instruction at %x, beyond the end of the script", _nr, offset);
+
+	PMachineInstruction instruction;
+	instruction.size = readPMachineInstruction(getBuf(offset), instruction.extOpcode, instruction.params);
+	instruction.lofsOffset = kNoLofsOffset;
+
+	// Relative offsets used by lofsa/lofss only depend on the script and the
+	// position of the instruction, so they can be resolved once here
+	const byte opcode = instruction.extOpcode >> 1;
+	if (opcode == op_lofsa || opcode == op_lofss)
+		instruction.lofsOffset = findOffset(instruction.params[0], this, offset + instruction.size);
+
+	_instructionIndex[offset] = _instructions.size();
+	_instructions.push_back(instruction);
+	return _instructions.back();
+}
+
 const SciSpan<const uint16> Script::getRelocationTableSci0Sci21() const {
 	SciSpan<const byte> relocationBlock;
 	uint16 numEntries;
@@ -22,6 +22,7 @@
 #ifndef SCI_ENGINE_SCRIPT_H
 #define SCI_ENGINE_SCRIPT_H
 
+#include "common/hashmap.h"
 #include "common/str.h"
 #include "sci/util.h"
 #include "sci/engine/segment.h"
@@ -101,6 +102,9 @@ private:
 	uint16 _offsetLookupStringCount;
 	uint16 _offsetLookupSaidCount;
 
+	Common::HashMap<uint32, uint32> _instructionIndex; /**< Index into _instructions for each decoded offset */
+	Common::Array<PMachineInstruction> _instructions; /**< Instructions decoded so far */
+
 public:
 	int getLocalsOffset() const { return _localsOffset; }
 	uint16 getLocalsCount() const { return _localsCount; }
@@ -299,7 +303,22 @@ public:
 	 */
 	uint32 getRelocationOffset(const uint32 offset) const;
 
+	/**
+	 * Gets the PMachine instruction at the given offset. Instructions are
+	 * decoded when they are first requested and kept until the script is
+	 * unloaded.
+	 * @param offset	The offset of the instruction in the script buffer
+	 */
+	const PMachineInstruction &getInstruction(uint32 offset) {
+		Common::HashMap<uint32, uint32>::const_iterator it = _instructionIndex.find(offset);
+		if (it != _instructionIndex.end())
+			return _instructions[it->_value];
+		return decodeInstruction(offset);
+	}
+
 private:
+	const PMachineInstruction &decodeInstruction(uint32 offset);
+
 	/**
 	 * Returns a Span containing the relocation table for a SCI0-SCI2.1 script.
 	 * (The SCI0-SCI2.1 relocation table is simply a list of all of the
@@ -42,6 +42,8 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_saveDirPtr = NULL_REG;
 	_parserPtr = NULL_REG;
 
+	_allocationCount = 0;
+
 #ifdef ENABLE_SCI32
 	_arraysSegId = 0;
 	_bitmapSegId = 0;
@@ -79,6 +81,11 @@ void SegManager::resetSegMan() {
 	// Reinitialize class table
 	_classTable.clear();
 	createClassTable();
+
+	_selectorLookupCache.flush();
+
+	// Whatever gets loaded into the new heap has not been collected yet
+	_allocationCount++;
 }
 
 void SegManager::initSysStrings() {
@@ -176,6 +183,9 @@ void SegManager::deallocate(SegmentId seg) {
 			if (_heap[scr->getLocalsSegment()])
 				deallocate(scr->getLocalsSegment());
 		}
+
+		// The objects of the script are gone
+		_selectorLookupCache.flush();
 	}
 
 	delete mobj;
@@ -459,6 +469,7 @@ reg_t SegManager::allocateHunkEntry(const char *hunk_type, int size) {
 	}
 
 	int offset = table->allocEntry();
+	_allocationCount++;
 
 	reg_t addr = make_reg(_hunksSegId, offset);
 	Hunk &h = table->at(offset);
@@ -492,6 +503,7 @@ Clone *SegManager::allocateClone(reg_t *addr) {
 	}
 
 	int offset = table->allocEntry();
+	_allocationCount++;
 
 	*addr = make_reg(_clonesSegId, offset);
 	return &table->at(offset);
@@ -508,6 +520,7 @@ List *SegManager::allocateList(reg_t *addr) {
 	}
 
 	int offset = table->allocEntry();
+	_allocationCount++;
 
 	*addr = make_reg(_listsSegId, offset);
 	return &table->at(offset);
@@ -524,6 +537,7 @@ Node *SegManager::allocateNode(reg_t *addr) {
 	}
 
 	int offset = table->allocEntry();
+	_allocationCount++;
 
 	*addr = make_reg(_nodesSegId, offset);
 	return &table->at(offset);
@@ -908,6 +922,7 @@ Common::String SegManager::getString(reg_t pointer) {
 byte *SegManager::allocDynmem(int size, const char *descr, reg_t *addr) {
 	DynMem *dynmem = new DynMem();
 	SegmentId segid = allocSegment(dynmem);
+	_allocationCount++;
 	*addr = make_reg(segid, 0);
 
 	dynmem->_size = size;
@@ -950,6 +965,7 @@ SciArray *SegManager::allocateArray(SciArrayType type, uint16 size, reg_t *addr)
 	}
 
 	int offset = table->allocEntry();
+	_allocationCount++;
 
 	*addr = make_reg(_arraysSegId, offset);
 
@@ -1006,6 +1022,7 @@ SciBitmap *SegManager::allocateBitmap(reg_t *addr, const int16 width, const int1
 	}
 
 	int offset = table->allocEntry();
+	_allocationCount++;
 
 	*addr = make_reg(_bitmapSegId, offset);
 	SciBitmap &bitmap = table->at(offset);
@@ -1106,6 +1123,10 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 	g_sci->_guestAdditions->instantiateScriptHook(*scr);
 #endif
 
+	// The script may have been reloaded in place of a freed one, in which
+	// case its objects replace the old ones at the same addresses
+	_selectorLookupCache.flush();
+
 	return segmentId;
 }
 
@@ -1136,6 +1157,7 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (!scr->getLockers()) {
 		// The actual script deletion seems to be done by SCI scripts themselves
 		scr->markDeleted();
+		_allocationCount++;
 		debugC(kDebugLevelScripts, "Unloaded script 0x%x.", script_nr);
 	}
 }
@@ -460,6 +460,15 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	SelectorLookupCache &getSelectorLookupCache() { return _selectorLookupCache; }
+
+	/**
+	 * Returns a counter which is increased whenever something the garbage
+	 * collector may free is allocated, or a script is marked for deletion.
+	 * If it didn't change since the last collection, a new one is pointless.
+	 */
+	uint32 getAllocationCount() const { return _allocationCount; }
+
 private:
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
@@ -474,6 +483,11 @@ private:
 	SegmentId _nodesSegId; ///< ID of the (a) node segment
 	SegmentId _hunksSegId; ///< ID of the (a) hunk segment
 
+	/** Results of lookupSelector(), valid until a script is loaded or unloaded */
+	SelectorLookupCache _selectorLookupCache;
+
+	uint32 _allocationCount;
+
 	// Statically allocated memory for system strings
 	reg_t _saveDirPtr;
 	reg_t _parserPtr;
@@ -336,31 +336,81 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x", PRINT_REG(obj_location));
 	}
 
-	int index = obj->locateVarSelector(segMan, selectorId);
-
-	if (index >= 0) {
-		// Found it as a variable
-		if (varp) {
-			varp->obj = obj_location;
-			varp->varindex = index;
-		}
-		return kSelectorVariable;
+	// Clones share the results of the script object they were cloned from
+	const reg_t objPos = obj->getPos();
+	SelectorLookupCache &cache = segMan->getSelectorLookupCache();
+	const SelectorLookupCache::Entry *cached = cache.find(objPos, selectorId);
+	SelectorLookupCache::Entry result;
+
+	if (cached) {
+		result = *cached;
 	} else {
-		// Check if it's a method, with recursive lookup in superclasses
-		while (obj) {
-			index = obj->funcSelectorPosition(selectorId);
-			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
-				return kSelectorMethod;
-			} else {
-				obj = segMan->getObject(obj->getSuperClassSelector());
+		result.type = kSelectorNone;
+		result.varIndex = -1;
+		result.funcPtr = NULL_REG;
+
+		int index = obj->locateVarSelector(segMan, selectorId);
+
+		if (index >= 0) {
+			// Found it as a variable
+			result.type = kSelectorVariable;
+			result.varIndex = index;
+		} else {
+			// Check if it's a method, with recursive lookup in superclasses
+			while (obj) {
+				index = obj->funcSelectorPosition(selectorId);
+				if (index >= 0) {
+					result.type = kSelectorMethod;
+					result.funcPtr = obj->getFunction(index);
+					break;
+				} else {
+					obj = segMan->getObject(obj->getSuperClassSelector());
+				}
 			}
 		}
 
-		return kSelectorNone;
+		cache.add(objPos, selectorId, result);
+	}
+
+	if (result.type == kSelectorVariable && varp) {
+		varp->obj = obj_location;
+		varp->varindex = result.varIndex;
+	} else if (result.type == kSelectorMethod && fptr) {
+		*fptr = result.funcPtr;
+	}
+
+	return result.type;
+}
+
+const SelectorLookupCache::Entry *SelectorLookupCache::find(reg_t objPos, Selector selectorId) {
+	Key key;
+	key.objPos = objPos;
+	key.selectorId = selectorId;
+
+	Common::HashMap<Key, Entry, Key_Hash>::const_iterator it = _entries.find(key);
+	if (it == _entries.end()) {
+		_misses++;
+		return nullptr;
 	}
+
+	_hits++;
+	return &it->_value;
+}
+
+void SelectorLookupCache::add(reg_t objPos, Selector selectorId, const Entry &entry) {
+	Key key;
+	key.objPos = objPos;
+	key.selectorId = selectorId;
+
+	_entries[key] = entry;
+}
+
+void SelectorLookupCache::flush() {
+	if (_entries.empty())
+		return;
+
+	_entries.clear();
+	_flushes++;
 }
 
 } // End of namespace Sci
@@ -76,6 +76,9 @@ EngineState::EngineState(SegManager *segMan) :
 
 EngineState::~EngineState() {
 	delete _msgState;
+
+	for (Common::List<PathfindingGraph *>::iterator it = pathfindingGraphs.begin(); it != pathfindingGraphs.end(); ++it)
+		delete *it;
 }
 
 void EngineState::reset(bool isRestoring) {
@@ -104,6 +107,7 @@ void EngineState::reset(bool isRestoring) {
 	lastWaitTime = 0;
 
 	gcCountDown = 0;
+	gcAllocationCount = 0;
 
 	_eventCounter = 0;
 	_paletteSetIntensityCounter = 0;
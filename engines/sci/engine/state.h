@@ -24,6 +24,8 @@
 
 #include "common/scummsys.h"
 #include "common/array.h"
+#include "common/list.h"
+#include "common/rect.h"
 #include "common/serializer.h"
 #include "common/str-array.h"
 
@@ -97,6 +99,66 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * Statistics about the garbage collector runs.
+ */
+struct GCStatistics {
+	uint32 runs; //< Number of collections performed
+	uint32 skipped; //< Number of periodic collections skipped, as nothing was allocated since the last one
+	uint32 freed; //< Number of objects freed
+	uint32 lastPause; //< Duration of the last collection, in milliseconds
+	uint32 maxPause; //< Duration of the longest collection, in milliseconds
+	uint32 totalPause; //< Total duration of all collections, in milliseconds
+
+	GCStatistics() { reset(); }
+	void reset() { runs = skipped = freed = lastPause = maxPause = totalPause = 0; }
+};
+
+/**
+ * The input of a kAvoidPath call, as recorded for replaying it in the debugger
+ */
+struct PathfindingInput {
+	Common::Array<int> polygonTypes; //< Type of each polygon
+	Common::Array<uint> polygonSizes; //< Number of vertices of each polygon
+	Common::Array<Common::Point> points; //< The vertices of all polygons
+	Common::Point start;
+	Common::Point end;
+	int width;
+	int height;
+	int opt;
+};
+
+/**
+ * The visibility graph of a set of pathfinding obstacles. As the obstacles of
+ * a room rarely change, kAvoidPath keeps the graph across calls, so that the
+ * vertices visible from an obstacle vertex only need to be computed once.
+ */
+struct PathfindingGraph {
+	Common::Array<uint> polygonSizes; //< Number of vertices of each polygon
+	Common::Array<Common::Point> points; //< The vertices of all polygons
+	Common::Array<Common::Array<uint16> > visible; //< Indices of the vertices visible from each vertex
+	Common::Array<bool> computed; //< Whether the visible vertices of each vertex are known
+};
+
+struct PathfindingStatistics {
+	uint32 queries; //< Number of pathfinding calls
+	uint32 graphHits; //< Calls that reused a cached visibility graph
+	uint32 graphMisses; //< Calls that had to start a new visibility graph
+	uint32 graphBypassed; //< Calls where the start or end point split an obstacle edge
+	uint32 listsComputed; //< Visible vertex lists computed
+	uint32 listsReused; //< Visible vertex lists taken from a cached graph
+	uint32 lastTime; //< Duration of the last call, in milliseconds
+	uint32 maxTime; //< Duration of the longest call, in milliseconds
+	uint32 totalTime; //< Total duration of all calls, in milliseconds
+
+	PathfindingStatistics() { reset(); }
+	void reset() {
+		queries = graphHits = graphMisses = graphBypassed = 0;
+		listsComputed = listsReused = 0;
+		lastTime = maxTime = totalTime = 0;
+	}
+};
+
 struct EngineState : public Common::Serializable {
 	EngineState(SegManager *segMan);
 	~EngineState() override;
@@ -188,6 +250,12 @@ struct EngineState : public Common::Serializable {
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	uint32 gcAllocationCount; /**< Allocation count of the segment manager at the last gc */
+	GCStatistics gcStats;
+
+	Common::List<PathfindingGraph *> pathfindingGraphs; /**< Recently used visibility graphs, most recent first */
+	Common::List<PathfindingInput> pathfindingInputs; /**< The most recent kAvoidPath inputs, oldest first */
+	PathfindingStatistics pathfindingStats;
 
 	MessageState *_msgState;
 	void initMessageState();
@@ -626,7 +626,20 @@ void run_vm(EngineState *s) {
 
 		// Get opcode
 		byte extOpcode;
-		s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
+		uint32 lofsOffset = kNoLofsOffset;
+		if (g_sci->_debugState.debugging) {
+			// Parse the script buffer directly while stepping through
+			// scripts, so that the debugger always sees the actual bytes
+			s->xs->addr.pc.incOffset(readPMachineInstruction(scr->getBuf(s->xs->addr.pc.getOffset()), extOpcode, opparams));
+		} else {
+			const PMachineInstruction &instruction = scr->getInstruction(s->xs->addr.pc.getOffset());
+			extOpcode = instruction.extOpcode;
+			memcpy(opparams, instruction.params, sizeof(opparams));
+			// lofs offsets are resolved against the script owning the code
+			if (scr == local_script)
+				lofsOffset = instruction.lofsOffset;
+			s->xs->addr.pc.incOffset(instruction.size);
+		}
 		const byte opcode = extOpcode >> 1;
 		//debug("%s: %d, %d, %d, %d, acc = %04x:%04x, script %d, local script %d", opcodeNames[opcode], opparams[0], opparams[1], opparams[2], opparams[3], PRINT_REG(s->r_acc), scr->getScriptNumber(), local_script->getScriptNumber());
 
@@ -854,7 +867,7 @@ void run_vm(EngineState *s) {
 			// Run the garbage collector, if needed
 			if (s->gcCountDown-- <= 0) {
 				s->gcCountDown = s->scriptGCInterval;
-				run_gc(s);
+				run_gc(s, true);
 			}
 
 			// Call kernel function
@@ -1199,7 +1212,9 @@ void run_vm(EngineState *s) {
 			// Load offset to accumulator or push to stack
 
 			r_temp.setSegment(s->xs->addr.pc.getSegment());
-			r_temp.setOffset(findOffset(opparams[0], local_script, s->xs->addr.pc.getOffset()));
+			if (lofsOffset == kNoLofsOffset)
+				lofsOffset = findOffset(opparams[0], local_script, s->xs->addr.pc.getOffset());
+			r_temp.setOffset(lofsOffset);
 			if (r_temp.getOffset() >= scr->getBufSize())
 				error("VM: lofsa/lofss operation overflowed: %04x:%04x beyond end"
 						  " of script (at %04x)", PRINT_REG(r_temp), scr->getBufSize());
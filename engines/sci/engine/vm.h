@@ -27,6 +27,7 @@
 #include "sci/engine/vm_types.h"	// for reg_t
 #include "sci/resource/resource.h"	// for SciVersion
 
+#include "common/hashmap.h"
 #include "common/util.h"
 
 namespace Sci {
@@ -398,6 +399,65 @@ void run_vm(EngineState *s);
 SelectorType lookupSelector(SegManager *segMan, reg_t obj, Selector selectorid,
 		ObjVarRef *varp, reg_t *fptr);
 
+/**
+ * Cache of the results of lookupSelector().
+ *
+ * Resolving a selector scans the variable table of the object's class and
+ * the method tables of its superclass chain. The result only depends on the
+ * script object the object was created from (clones resolve exactly like
+ * their parent), so it is kept per script object and selector. The cache
+ * has to be flushed whenever script objects are created or freed, i.e. when
+ * scripts are loaded or unloaded.
+ */
+class SelectorLookupCache {
+public:
+	struct Entry {
+		SelectorType type;
+		int varIndex;  ///< Index of the variable, for kSelectorVariable
+		reg_t funcPtr; ///< Address of the method, for kSelectorMethod
+	};
+
+	SelectorLookupCache() : _hits(0), _misses(0), _flushes(0) {}
+
+	/**
+	 * Look up the cached result for a selector of a script object.
+	 * @return the cached entry, or nullptr if there is none
+	 */
+	const Entry *find(reg_t objPos, Selector selectorId);
+
+	/** Store the result for a selector of a script object. */
+	void add(reg_t objPos, Selector selectorId, const Entry &entry);
+
+	/** Drop all cached results. */
+	void flush();
+
+	void resetStats() { _hits = _misses = _flushes = 0; }
+
+	uint size() const { return _entries.size(); }
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	uint32 getFlushes() const { return _flushes; }
+
+private:
+	struct Key {
+		reg_t objPos;
+		Selector selectorId;
+
+		bool operator==(const Key &other) const { return objPos == other.objPos && selectorId == other.selectorId; }
+	};
+
+	struct Key_Hash {
+		uint operator()(const Key &key) const {
+			return (key.objPos.getSegment() << 3) ^ key.objPos.getOffset() ^ (key.selectorId << 16);
+		}
+	};
+
+	Common::HashMap<Key, Entry, Key_Hash> _entries;
+	uint32 _hits;
+	uint32 _misses;
+	uint32 _flushes;
+};
+
 /**
  * Read a PMachine instruction from a memory buffer and return its length.
  *
@@ -416,6 +476,22 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj, Selector selectorid,
  */
 int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4]);
 
+/**
+ * A PMachine instruction as decoded by readPMachineInstruction(), kept by
+ * each script so that the VM does not have to parse the instruction bytes
+ * again every time the instruction is executed.
+ */
+struct PMachineInstruction {
+	byte extOpcode;   ///< "extended" opcode
+	uint16 size;      ///< length of the instruction in bytes
+	int16 params[4];  ///< parameters of the instruction
+	uint32 lofsOffset; ///< resolved target of lofsa/lofss, or kNoLofsOffset
+};
+
+enum : uint32 {
+	kNoLofsOffset = 0xFFFFFFFF
+};
+
 /**
  * Finds the script-absolute offset of a relative object offset.
  *
@@ -84,13 +84,18 @@ const CelScalerTable &CelScaler::getScalerTable(const Ratio &scaleX, const Ratio
 #pragma mark -
 #pragma mark CelObj
 bool CelObj::_drawBlackLines = false;
+bool CelObj::_useLarryScale = false;
 
 void CelObj::init() {
 	CelObj::deinit();
 	_drawBlackLines = false;
-	_nextCacheId = 1;
+	syncScalerSettings();
 	_scaler = new CelScaler();
-	_cache = new CelCache(100);
+	_cache = new CelCache(kCelCacheBudget);
+}
+
+void CelObj::syncScalerSettings() {
+	_useLarryScale = Common::checkGameGUIOption(GAMEOPTION_LARRYSCALE, ConfMan.get("guioptions")) && ConfMan.getBool("enable_larryscale");
 }
 
 void CelObj::deinit() {
@@ -105,6 +110,12 @@ void CelObj::deinit() {
 
 template<bool FLIP, typename READER>
 struct SCALER_NoScale {
+	/**
+	 * Whether the pixels of a row are read in order from contiguous memory,
+	 * starting at getRowPointer().
+	 */
+	static const bool kContiguousRows = !FLIP;
+
 #ifndef RELEASE_BUILD
 	const byte *_rowEdge;
 #endif
@@ -144,6 +155,10 @@ struct SCALER_NoScale {
 		}
 	}
 
+	inline const byte *getRowPointer() const {
+		return _row;
+	}
+
 	inline byte read() {
 #ifndef RELEASE_BUILD
 		assert(_row != _rowEdge);
@@ -158,6 +173,8 @@ struct SCALER_NoScale {
 
 template<bool FLIP, typename READER>
 struct SCALER_Scale {
+	static const bool kContiguousRows = false;
+
 #ifndef RELEASE_BUILD
 	int16 _minX;
 	int16 _maxX;
@@ -210,8 +227,7 @@ struct SCALER_Scale {
 
 		const CelScalerTable &table = CelObj::_scaler->getScalerTable(scaleX, scaleY);
 
-		const bool useLarryScale = Common::checkGameGUIOption(GAMEOPTION_LARRYSCALE, ConfMan.get("guioptions")) && ConfMan.getBool("enable_larryscale");
-		if (useLarryScale) {
+		if (CelObj::_useLarryScale) {
 			// LarryScale is an alternative, high-quality cel scaler implemented
 			// for ScummVM. Due to the nature of smooth upscaling, it does *not*
 			// respect the global scaling pattern. Instead, it simply scales the
@@ -308,6 +324,10 @@ struct SCALER_Scale {
 #endif
 	}
 
+	inline const byte *getRowPointer() const {
+		return _row;
+	}
+
 	inline byte read() {
 #ifndef RELEASE_BUILD
 		assert(_x >= _minX && _x <= _maxX);
@@ -364,18 +384,22 @@ struct READER_Compressed {
 private:
 	const SciSpan<const byte> _resource;
 	byte _buffer[kCelScalerTableSize];
+	const byte *_pixels;
 	uint32 _controlOffset;
 	uint32 _dataOffset;
 	uint32 _uncompressedDataOffset;
 	int16 _y;
+	const int16 _sourceWidth;
 	const int16 _sourceHeight;
 	const uint8 _skipColor;
-	const int16 _maxWidth;
+	int16 _maxWidth;
 
 public:
 	READER_Compressed(const CelObj &celObj, const int16 maxWidth) :
 	_resource(celObj.getResPointer()),
+	_pixels(nullptr),
 	_y(-1),
+	_sourceWidth(celObj._width),
 	_sourceHeight(celObj._height),
 	_skipColor(celObj._skipColor),
 	_maxWidth(maxWidth) {
@@ -385,64 +409,88 @@ public:
 		_dataOffset = celHeader.getUint32SEAt(24);
 		_uncompressedDataOffset = celHeader.getUint32SEAt(28);
 		_controlOffset = celHeader.getUint32SEAt(32);
+
+		// Decompress the whole cel once and keep it in the cel cache, so
+		// drawing the same cel again only costs a lookup
+		_pixels = CelObj::_cache->getPixels(celObj._info);
+		const uint32 size = _sourceWidth * _sourceHeight;
+		if (_pixels == nullptr && _sourceWidth < kCelScalerTableSize && CelObj::_cache->canCachePixels(size)) {
+			byte *pixels = new byte[size];
+			_maxWidth = _sourceWidth;
+			for (int16 y = 0; y < _sourceHeight; ++y) {
+				decompressRow(y);
+				memcpy(pixels + y * _sourceWidth, _buffer, _sourceWidth);
+			}
+			CelObj::_cache->putPixels(celObj._info, pixels, size);
+			_pixels = pixels;
+		}
 	}
 
 	inline const byte *getRow(const int16 y) {
 		assert(y >= 0 && y < _sourceHeight);
+		if (_pixels) {
+			return _pixels + y * _sourceWidth;
+		}
+
 		if (y != _y) {
-			// compressed data segment for row
-			const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
+			decompressRow(y);
+			_y = y;
+		}
 
-			uint32 rowCompressedSize;
-			if (y + 1 < _sourceHeight) {
-				rowCompressedSize = _resource.getUint32SEAt(_controlOffset + (y + 1) * sizeof(uint32)) - rowOffset;
-			} else {
-				rowCompressedSize = _resource.size() - rowOffset - _dataOffset;
-			}
+		return _buffer;
+	}
 
-			const byte *row = _resource.getUnsafeDataAt(_dataOffset + rowOffset, rowCompressedSize);
+private:
+	void decompressRow(const int16 y) {
+		// compressed data segment for row
+		const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
 
-			// uncompressed data segment for row
-			const uint32 literalOffset = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + y * sizeof(uint32));
+		uint32 rowCompressedSize;
+		if (y + 1 < _sourceHeight) {
+			rowCompressedSize = _resource.getUint32SEAt(_controlOffset + (y + 1) * sizeof(uint32)) - rowOffset;
+		} else {
+			rowCompressedSize = _resource.size() - rowOffset - _dataOffset;
+		}
 
-			uint32 literalRowSize;
-			if (y + 1 < _sourceHeight) {
-				literalRowSize = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + (y + 1) * sizeof(uint32)) - literalOffset;
-			} else {
-				literalRowSize = _resource.size() - literalOffset - _uncompressedDataOffset;
-			}
+		const byte *row = _resource.getUnsafeDataAt(_dataOffset + rowOffset, rowCompressedSize);
 
-			const byte *literal = _resource.getUnsafeDataAt(_uncompressedDataOffset + literalOffset, literalRowSize);
+		// uncompressed data segment for row
+		const uint32 literalOffset = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + y * sizeof(uint32));
 
-			uint8 length;
-			for (int16 i = 0; i < _maxWidth; i += length) {
-				const byte controlByte = *row++;
-				length = controlByte;
+		uint32 literalRowSize;
+		if (y + 1 < _sourceHeight) {
+			literalRowSize = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + (y + 1) * sizeof(uint32)) - literalOffset;
+		} else {
+			literalRowSize = _resource.size() - literalOffset - _uncompressedDataOffset;
+		}
 
-				// Run-length encoded
-				if (controlByte & 0x80) {
-					length &= 0x3F;
-					assert(i + length < (int)sizeof(_buffer));
+		const byte *literal = _resource.getUnsafeDataAt(_uncompressedDataOffset + literalOffset, literalRowSize);
 
-					// Fill with skip color
-					if (controlByte & 0x40) {
-						memset(_buffer + i, _skipColor, length);
-					// Next value is fill color
-					} else {
-						memset(_buffer + i, *literal, length);
-						++literal;
-					}
-				// Uncompressed
+		uint8 length;
+		for (int16 i = 0; i < _maxWidth; i += length) {
+			const byte controlByte = *row++;
+			length = controlByte;
+
+			// Run-length encoded
+			if (controlByte & 0x80) {
+				length &= 0x3F;
+				assert(i + length < (int)sizeof(_buffer));
+
+				// Fill with skip color
+				if (controlByte & 0x40) {
+					memset(_buffer + i, _skipColor, length);
+				// Next value is fill color
 				} else {
-					assert(i + length < (int)sizeof(_buffer));
-					memcpy(_buffer + i, literal, length);
-					literal += length;
+					memset(_buffer + i, *literal, length);
+					++literal;
 				}
+			// Uncompressed
+			} else {
+				assert(i + length < (int)sizeof(_buffer));
+				memcpy(_buffer + i, literal, length);
+				literal += length;
 			}
-			_y = y;
 		}
-
-		return _buffer;
 	}
 };
 
@@ -475,6 +523,8 @@ inline byte translateMacColor(bool isMacSource, byte color) {
  * remapping data.
  */
 struct MAPPER_NoMD {
+	static const bool kCopiesRows = false;
+
 	inline void draw(byte *target, const byte pixel, const uint8 skipColor, const bool isMacSource) const {
 		if (pixel != skipColor) {
 			*target = translateMacColor(isMacSource, pixel);
@@ -487,6 +537,12 @@ struct MAPPER_NoMD {
  * no remapping data.
  */
 struct MAPPER_NoMDNoSkip {
+	/**
+	 * Rows of pixels are drawn unchanged, so they can be copied as a whole
+	 * when they are contiguous in the source data.
+	 */
+	static const bool kCopiesRows = true;
+
 	inline void draw(byte *target, const byte pixel, const uint8, const bool isMacSource) const {
 		*target = translateMacColor(isMacSource, pixel);
 	}
@@ -497,14 +553,25 @@ struct MAPPER_NoMDNoSkip {
  * remapping data, and remapping enabled.
  */
 struct MAPPER_Map {
+	static const bool kCopiesRows = false;
+
+	// The remap state does not change while a cel is drawn, so it is looked
+	// up once instead of once per pixel
+	const GfxRemap32 &_remap;
+	const uint8 _startColor;
+
+	MAPPER_Map() :
+	_remap(*g_sci->_gfxRemap32),
+	_startColor(_remap.getStartColor()) {}
+
 	inline void draw(byte *target, const byte pixel, const uint8 skipColor, const bool isMacSource) const {
 		if (pixel != skipColor) {
 			// For some reason, SSCI never checks if the source pixel is *above*
 			// the range of remaps, so we do not either.
-			if (pixel < g_sci->_gfxRemap32->getStartColor()) {
+			if (pixel < _startColor) {
 				*target = translateMacColor(isMacSource, pixel);
-			} else if (g_sci->_gfxRemap32->remapEnabled(pixel)) {
-				*target = g_sci->_gfxRemap32->remapColor(translateMacColor(isMacSource, pixel), *target);
+			} else if (_remap.remapEnabled(pixel)) {
+				*target = _remap.remapColor(translateMacColor(isMacSource, pixel), *target);
 			}
 		}
 	}
@@ -515,10 +582,17 @@ struct MAPPER_Map {
  * remapping data, and remapping disabled.
  */
 struct MAPPER_NoMap {
+	static const bool kCopiesRows = false;
+
+	const uint8 _startColor;
+
+	MAPPER_NoMap() :
+	_startColor(g_sci->_gfxRemap32->getStartColor()) {}
+
 	inline void draw(byte *target, const byte pixel, const uint8 skipColor, const bool isMacSource) const {
 		// For some reason, SSCI never checks if the source pixel is *above* the
 		// range of remaps, so we do not either.
-		if (pixel != skipColor && pixel < g_sci->_gfxRemap32->getStartColor()) {
+		if (pixel != skipColor && pixel < _startColor) {
 			*target = translateMacColor(isMacSource, pixel);
 		}
 	}
@@ -698,45 +772,123 @@ void CelObj::submitPalette() const {
 #pragma mark -
 #pragma mark CelObj - Caching
 
-int CelObj::_nextCacheId = 1;
 CelCache *CelObj::_cache = nullptr;
 
-int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
-	*nextInsertIndex = -1;
-	int oldestId = _nextCacheId + 1;
-	int oldestIndex = 0;
+const CelObj *CelObj::searchCache(const CelInfo32 &celInfo) const {
+	return _cache->getCelObj(celInfo);
+}
 
-	for (int i = 0, len = _cache->size(); i < len; ++i) {
-		CelCacheEntry &entry = (*_cache)[i];
+void CelObj::putCopyInCache() const {
+	_cache->putCelObj(duplicate());
+}
 
-		if (entry.celObj == nullptr) {
-			if (*nextInsertIndex == -1) {
-				*nextInsertIndex = i;
-			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
-		} else if (oldestId > entry.id) {
-			oldestId = entry.id;
-			oldestIndex = i;
-		}
+#pragma mark -
+#pragma mark CelCache
+
+CelCache::CelCache(const uint32 budget) :
+	_budget(budget),
+	_usage(0),
+	_hits(0),
+	_misses(0),
+	_pixelHits(0),
+	_pixelMisses(0) {}
+
+CelCache::~CelCache() {
+	clear();
+}
+
+const CelObj *CelCache::getCelObj(const CelInfo32 &info) {
+	EntryMap::iterator it = _entries.find(info);
+	if (it == _entries.end() || !it->_value.celObj) {
+		++_misses;
+		return nullptr;
 	}
 
-	if (*nextInsertIndex == -1) {
-		*nextInsertIndex = oldestIndex;
+	++_hits;
+	return touch(info).celObj;
+}
+
+void CelCache::putCelObj(CelObj *celObj) {
+	Entry &entry = touch(celObj->_info);
+	if (entry.celObj) {
+		delete entry.celObj;
+	} else {
+		// Cel objects only differ by a few fields, so they are all accounted
+		// for with the size of the largest cached type
+		const uint32 celObjSize = MAX(sizeof(CelObjView), sizeof(CelObjPic));
+		entry.size += celObjSize;
+		_usage += celObjSize;
+	}
+	entry.celObj = celObj;
+	evict();
+}
+
+const byte *CelCache::getPixels(const CelInfo32 &info) {
+	EntryMap::iterator it = _entries.find(info);
+	if (it == _entries.end() || !it->_value.pixels) {
+		++_pixelMisses;
+		return nullptr;
 	}
 
-	return -1;
+	++_pixelHits;
+	return touch(info).pixels;
 }
 
-void CelObj::putCopyInCache(const int cacheIndex) const {
-	if (cacheIndex == -1) {
-		error("Invalid cache index");
+void CelCache::putPixels(const CelInfo32 &info, byte *pixels, const uint32 size) {
+	Entry &entry = touch(info);
+	if (entry.pixels) {
+		delete[] pixels;
+		return;
 	}
+	entry.pixels = pixels;
+	entry.size += size;
+	_usage += size;
+	evict();
+}
 
-	CelCacheEntry &entry = (*_cache)[cacheIndex];
-	entry.celObj.reset(duplicate());
-	entry.id = ++_nextCacheId;
+void CelCache::setBudget(const uint32 budget) {
+	_budget = budget;
+	evict();
+}
+
+void CelCache::clear() {
+	while (!_entries.empty()) {
+		removeEntry(_entries.begin());
+	}
+}
+
+CelCache::Entry &CelCache::touch(const CelInfo32 &info) {
+	EntryMap::iterator it = _entries.find(info);
+	if (it != _entries.end()) {
+		Entry &entry = it->_value;
+		_lru.erase(entry.lruPos);
+		_lru.push_front(info);
+		entry.lruPos = _lru.begin();
+		return entry;
+	}
+
+	_lru.push_front(info);
+	Entry &entry = _entries[info];
+	entry.celObj = nullptr;
+	entry.pixels = nullptr;
+	entry.size = 0;
+	entry.lruPos = _lru.begin();
+	return entry;
+}
+
+void CelCache::evict() {
+	while (_usage > _budget && _lru.size() > 1) {
+		removeEntry(_entries.find(_lru.back()));
+	}
+}
+
+void CelCache::removeEntry(EntryMap::iterator it) {
+	Entry &entry = it->_value;
+	delete entry.celObj;
+	delete[] entry.pixels;
+	_usage -= entry.size;
+	_lru.erase(entry.lruPos);
+	_entries.erase(it);
 }
 
 #pragma mark -
@@ -770,8 +922,13 @@ struct RENDERER {
 
 			_scaler.setTarget(targetRect.left, targetRect.top + y);
 
-			for (int16 x = 0; x < targetWidth; ++x) {
-				_mapper.draw(targetPixel++, _scaler.read(), _skipColor, _isMacSource);
+			if (MAPPER::kCopiesRows && SCALER::kContiguousRows && !_isMacSource) {
+				memcpy(targetPixel, _scaler.getRowPointer(), targetWidth);
+				targetPixel += targetWidth;
+			} else {
+				for (int16 x = 0; x < targetWidth; ++x) {
+					_mapper.draw(targetPixel++, _scaler.read(), _skipColor, _isMacSource);
+				}
 			}
 
 			targetPixel += skipStride;
@@ -983,16 +1140,13 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 	_compressionType = kCelCompressionInvalid;
 	_transparent = true;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjView *const cachedCelObj = dynamic_cast<CelObjView *>(entry.celObj.get());
+	const CelObj *const cacheEntry = searchCache(_info);
+	if (cacheEntry != nullptr) {
+		const CelObjView *const cachedCelObj = dynamic_cast<const CelObjView *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjView in cache slot %d", cacheIndex);
+			error("Expected a CelObjView in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1090,7 +1244,7 @@ CelObjView::CelObjView(const GuiResourceId viewId, const int16 loopNo, const int
 		_remap = analyzeForRemap();
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjView::analyzeUncompressedForRemap() const {
@@ -1191,16 +1345,13 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 	_transparent = true;
 	_remap = false;
 
-	int cacheInsertIndex;
-	const int cacheIndex = searchCache(_info, &cacheInsertIndex);
-	if (cacheIndex != -1) {
-		CelCacheEntry &entry = (*_cache)[cacheIndex];
-		const CelObjPic *const cachedCelObj = dynamic_cast<CelObjPic *>(entry.celObj.get());
+	const CelObj *const cacheEntry = searchCache(_info);
+	if (cacheEntry != nullptr) {
+		const CelObjPic *const cachedCelObj = dynamic_cast<const CelObjPic *>(cacheEntry);
 		if (cachedCelObj == nullptr) {
-			error("Expected a CelObjPic in cache slot %d", cacheIndex);
+			error("Expected a CelObjPic in cache for %s", _info.toString().c_str());
 		}
 		*this = *cachedCelObj;
-		entry.id = ++_nextCacheId;
 		return;
 	}
 
@@ -1264,7 +1415,7 @@ CelObjPic::CelObjPic(const GuiResourceId picId, const int16 celNo) {
 		}
 	}
 
-	putCopyInCache(cacheInsertIndex);
+	putCopyInCache();
 }
 
 bool CelObjPic::analyzeUncompressedForSkip() const {
@@ -22,6 +22,8 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
+#include "common/list.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource/resource.h"
@@ -105,7 +107,7 @@ struct CelInfo32 {
 
 	// This is the equivalence criteria used by CelObj::searchCache in at least
 	// SSCI SQ6. Notably, it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -115,7 +117,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -136,17 +138,110 @@ struct CelInfo32 {
 };
 
 class CelObj;
-struct CelCacheEntry {
+
+enum {
 	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
+	 * The default memory budget of the cel cache, in bytes.
 	 */
-	int id;
-	Common::ScopedPtr<CelObj> celObj;
-	CelCacheEntry() : id(0) {}
+	kCelCacheBudget = 4 * 1024 * 1024
 };
 
-typedef Common::Array<CelCacheEntry> CelCache;
+/**
+ * A cache of cel objects and of the decompressed pixels of cels, indexed by
+ * CelInfo32. Entries are accounted for in bytes, and the least recently used
+ * ones are dropped when the memory budget is exceeded.
+ */
+class CelCache {
+public:
+	CelCache(uint32 budget);
+	~CelCache();
+
+	/**
+	 * Returns the cached cel object matching the given CelInfo32, or null if
+	 * there is none.
+	 */
+	const CelObj *getCelObj(const CelInfo32 &info);
+
+	/**
+	 * Puts a cel object into the cache. The cache takes ownership of it.
+	 */
+	void putCelObj(CelObj *celObj);
+
+	/**
+	 * Returns the cached decompressed pixels of the cel matching the given
+	 * CelInfo32, or null if there are none.
+	 */
+	const byte *getPixels(const CelInfo32 &info);
+
+	/**
+	 * Returns whether decompressed pixels of the given size are worth caching.
+	 */
+	bool canCachePixels(uint32 size) const { return size <= _budget / 4; }
+
+	/**
+	 * Puts the decompressed pixels of a cel into the cache. The cache takes
+	 * ownership of the buffer, which must have been allocated with new[].
+	 */
+	void putPixels(const CelInfo32 &info, byte *pixels, uint32 size);
+
+	/**
+	 * Sets the maximum amount of memory, in bytes, used by the cache.
+	 */
+	void setBudget(uint32 budget);
+	uint32 getBudget() const { return _budget; }
+	uint32 getUsage() const { return _usage; }
+	uint size() const { return _entries.size(); }
+
+	void clear();
+
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	uint32 getPixelHits() const { return _pixelHits; }
+	uint32 getPixelMisses() const { return _pixelMisses; }
+	void resetStats() { _hits = _misses = _pixelHits = _pixelMisses = 0; }
+
+private:
+	struct CelInfo32_Hash {
+		uint operator()(const CelInfo32 &info) const {
+			return info.type ^ (info.resourceId << 3) ^ (info.loopNo << 19) ^ (info.celNo << 24) ^
+				(info.bitmap.getSegment() << 11) ^ info.bitmap.getOffset();
+		}
+	};
+
+	typedef Common::List<CelInfo32> LRUList;
+
+	struct Entry {
+		CelObj *celObj;
+		byte *pixels;
+		uint32 size;
+		LRUList::iterator lruPos;
+	};
+
+	typedef Common::HashMap<CelInfo32, Entry, CelInfo32_Hash> EntryMap;
+
+	EntryMap _entries;
+	LRUList _lru; // Most recently used entries first
+	uint32 _budget;
+	uint32 _usage;
+	uint32 _hits;
+	uint32 _misses;
+	uint32 _pixelHits;
+	uint32 _pixelMisses;
+
+	/**
+	 * Finds or creates the entry for the given CelInfo32 and marks it as the
+	 * most recently used one.
+	 */
+	Entry &touch(const CelInfo32 &info);
+
+	/**
+	 * Drops the least recently used entries until the cache fits its budget.
+	 * The most recently used entry is always kept.
+	 */
+	void evict();
+
+	void removeEntry(EntryMap::iterator it);
+};
 
 #pragma mark -
 #pragma mark CelScaler
@@ -262,6 +357,19 @@ protected:
 public:
 	static CelScaler *_scaler;
 
+	/**
+	 * When true, scaled cels are drawn using LarryScale.
+	 *
+	 * @note This is read from the game options by syncScalerSettings, which
+	 * is called once per frame instead of once for every scaled cel.
+	 */
+	static bool _useLarryScale;
+
+	/**
+	 * Updates the scaler settings from the game options.
+	 */
+	static void syncScalerSettings();
+
 	/**
 	 * The basic identifying information for this cel. This information
 	 * effectively acts as a composite key for a cel object, and any cel object
@@ -449,31 +557,25 @@ private:
 
 #pragma mark -
 #pragma mark CelObj - Caching
-protected:
-	/**
-	 * A monotonically increasing cache ID used to identify the least recently
-	 * used item in the cache for replacement.
-	 */
-	static int _nextCacheId;
-
+public:
 	/**
-	 * A cache of cel objects used to avoid reinitialisation overhead for cels
-	 * with the same CelInfo32.
+	 * A cache of cel objects and decompressed cel pixels, used to avoid
+	 * reinitialisation and decompression overhead for cels with the same
+	 * CelInfo32.
 	 */
 	static CelCache *_cache;
 
+protected:
 	/**
-	 * Searches the cel cache for a CelObj matching the provided CelInfo32. If
-	 * not found, -1 is returned. `nextInsertIndex` will receive the index of
-	 * the oldest item in the cache, which can be used to replace the oldest
-	 * item with a newer item.
+	 * Searches the cel cache for a CelObj matching the provided CelInfo32.
+	 * If not found, null is returned.
 	 */
-	int searchCache(const CelInfo32 &celInfo, int *nextInsertIndex) const;
+	const CelObj *searchCache(const CelInfo32 &celInfo) const;
 
 	/**
-	 * Puts a copy of this CelObj into the cache at the given cache index.
+	 * Puts a copy of this CelObj into the cache.
 	 */
-	void putCopyInCache(int index) const;
+	void putCopyInCache() const;
 };
 
 #pragma mark -
@@ -72,6 +72,8 @@ GfxFrameout::GfxFrameout(SegManager *segMan, GfxPalette32 *palette, GfxTransitio
 	_palMorphIsOn(false),
 	_lastScreenUpdateTick(0) {
 
+	resetFrameOutStats();
+
 	if (g_sci->getGameId() == GID_PHANTASMAGORIA) {
 		_currentBuffer.create(630, 450, Graphics::PixelFormat::createFormatCLUT8());
 	} else if (_isHiRes) {
@@ -479,6 +481,7 @@ void GfxFrameout::kernelAddPicAt(const reg_t planeObject, const GuiResourceId pi
 
 void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseRect) {
 	updateMousePositionForRendering();
+	CelObj::syncScalerSettings();
 
 	RobotDecoder &robotPlayer = g_sci->_video32->getRobotPlayer();
 	const bool robotIsActive = robotPlayer.getStatus() != RobotDecoder::kRobotStatusUninitialized;
@@ -499,12 +502,16 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 		remapMarkRedraw();
 	}
 
+	const uint32 calcStartTime = g_system->getMillis();
+
 	calcLists(_screenItemLists, eraseLists, eraseRect);
 
 	for (ScreenItemListList::iterator list = _screenItemLists.begin(); list != _screenItemLists.end(); ++list) {
 		list->sort();
 	}
 
+	const uint32 drawStartTime = g_system->getMillis();
+
 	for (ScreenItemListList::iterator list = _screenItemLists.begin(); list != _screenItemLists.end(); ++list) {
 		for (DrawList::iterator drawItem = list->begin(); drawItem != list->end(); ++drawItem) {
 			(*drawItem)->screenItem->getCelObj().submitPalette();
@@ -518,6 +525,13 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 		drawScreenItemList(_screenItemLists[i]);
 	}
 
+	const uint32 drawEndTime = g_system->getMillis();
+	_frameOutStats.frames++;
+	_frameOutStats.calcTime += drawStartTime - calcStartTime;
+	_frameOutStats.drawTime += drawEndTime - drawStartTime;
+	_frameOutStats.lastFrameTime = drawEndTime - calcStartTime;
+	_frameOutStats.maxFrameTime = MAX(_frameOutStats.maxFrameTime, _frameOutStats.lastFrameTime);
+
 	if (robotIsActive) {
 		robotPlayer.frameAlmostVisible();
 	}
@@ -535,6 +549,7 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 
 void GfxFrameout::palMorphFrameOut(const int8 *styleRanges, PlaneShowStyle *showStyle) {
 	updateMousePositionForRendering();
+	CelObj::syncScalerSettings();
 
 	Palette sourcePalette(_palette->getNextPalette());
 	alterVmap(sourcePalette, sourcePalette, -1, styleRanges);
@@ -1457,6 +1472,26 @@ void GfxFrameout::printPlaneListInternal(Console *con, const PlaneList &planeLis
 	}
 }
 
+void GfxFrameout::printFrameOutStats(Console *con) const {
+	const FrameOutStats &stats = _frameOutStats;
+	con->debugPrintf("Frames rendered: %d\n", stats.frames);
+	if (stats.frames) {
+		con->debugPrintf("Average time per frame (in milliseconds): %d.%02d (lists: %d.%02d, drawing: %d.%02d)\n",
+			(stats.calcTime + stats.drawTime) / stats.frames, (stats.calcTime + stats.drawTime) * 100 / stats.frames % 100,
+			stats.calcTime / stats.frames, stats.calcTime * 100 / stats.frames % 100,
+			stats.drawTime / stats.frames, stats.drawTime * 100 / stats.frames % 100);
+	}
+	con->debugPrintf("Last frame: %d ms, slowest frame: %d ms\n", stats.lastFrameTime, stats.maxFrameTime);
+}
+
+void GfxFrameout::resetFrameOutStats() {
+	_frameOutStats.frames = 0;
+	_frameOutStats.calcTime = 0;
+	_frameOutStats.drawTime = 0;
+	_frameOutStats.lastFrameTime = 0;
+	_frameOutStats.maxFrameTime = 0;
+}
+
 void GfxFrameout::printPlaneList(Console *con) const {
 	printPlaneListInternal(con, _planes);
 }
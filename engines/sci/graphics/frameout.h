@@ -329,6 +329,20 @@ private:
 	 */
 	bool _remapOccurred;
 
+	/**
+	 * Timing statistics of the frames rendered by `frameOut`, in
+	 * milliseconds.
+	 */
+	struct FrameOutStats {
+		uint32 frames;
+		uint32 calcTime; // Total time spent computing the draw and erase lists
+		uint32 drawTime; // Total time spent drawing into the internal buffer
+		uint32 lastFrameTime;
+		uint32 maxFrameTime;
+	};
+
+	FrameOutStats _frameOutStats;
+
 	/**
 	 * A list of rectangles, in screen coordinates, that represent portions of
 	 * the internal screen buffer that are dirty and should be drawn to the
@@ -452,6 +466,8 @@ public:
 	void printPlaneItemList(Console *con, const reg_t planeObject) const;
 	void printVisiblePlaneItemList(Console *con, const reg_t planeObject) const;
 	void printPlaneItemListInternal(Console *con, const ScreenItemList &screenItemList) const;
+	void printFrameOutStats(Console *con) const;
+	void resetFrameOutStats();
 };
 
 } // End of namespace Sci
@@ -366,6 +366,15 @@ void SmushDeltaBlocksDecoder::makeTable(int pitch, int index) {
 		dst += 4;                                             \
 	} while (0)
 
+/* Copy a run of 4x4 blocks from the same place in the other buffer. Blocks
+   of the same block row are adjacent, so this is done with four line copies
+   that memcpy can perform with the widest moves available on the platform */
+
+static inline void copyBlockRun(byte *dst, int32 nextOffs, int32 run, int pitch) {
+	for (int x = 0; x < 4; x++)
+		memcpy(dst + pitch * x, dst + nextOffs + pitch * x, run * 4);
+}
+
 void SmushDeltaBlocksDecoder::proc1(byte *dst, const byte *src, int32 nextOffs, int bw, int bh, int pitch, int16 *offsetTable) {
 	uint8 code;
 	bool filling, skipCode;
@@ -480,10 +489,12 @@ void SmushDeltaBlocksDecoder::proc4WithFDFE(byte *dst, const byte *src, int32 ne
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + nextOffs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
+				while (length > 0) {
+					const int32 run = MIN(length, i);
+					copyBlockRun(dst, nextOffs, run, pitch);
+					dst += run * 4;
+					length -= run;
+					i -= run;
 					if (i == 0) {
 						dst += pitch * 3;
 						bh--;
@@ -512,10 +523,12 @@ void SmushDeltaBlocksDecoder::proc4WithoutFDFE(byte *dst, const byte *src, int32
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + nextOffs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
+				while (length > 0) {
+					const int32 run = MIN(length, i);
+					copyBlockRun(dst, nextOffs, run, pitch);
+					dst += run * 4;
+					length -= run;
+					i -= run;
 					if (i == 0) {
 						dst += pitch * 3;
 						bh--;
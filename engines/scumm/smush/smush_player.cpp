@@ -217,7 +217,10 @@ static StringResource *getStrings(ScummEngine *vm, const char *file, bool is_enc
 }
 
 void SmushPlayer::timerCallback() {
+	const uint32 startTime = _vm->_system->getMillis();
 	parseNextFrame();
+	_decodeTime += _vm->_system->getMillis() - startTime;
+	_decodedFrames++;
 }
 
 SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *imuseDigital, Insane *insane) {
@@ -281,6 +284,8 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *imuseDigital, Insa
 	_paused = false;
 	_pauseStartTime = 0;
 	_pauseTime = 0;
+	_decodedFrames = 0;
+	_decodeTime = 0;
 
 	memset(_pal, 0, sizeof(_pal));
 	memset(_deltaPal, 0, sizeof(_deltaPal));
@@ -1448,6 +1453,8 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 	_frame = startFrame;
 
 	_pauseTime = 0;
+	_decodedFrames = 0;
+	_decodeTime = 0;
 
 	// This piece of code is used to ensure there are
 	// no audio hiccups while loading the SMUSH video;
@@ -1600,6 +1607,9 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			_vm->_system->delayMillis(10);
 	}
 
+	debugC(DEBUG_SMUSH, "Smush stats: %s: %d frames processed in %d ms (%d frames/sec)", filename,
+		_decodedFrames, _decodeTime, _decodedFrames * 1000 / MAX<uint32>(_decodeTime, 1));
+
 	release();
 
 	// Reset mouse state
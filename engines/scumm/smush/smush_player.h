@@ -288,6 +288,9 @@ protected:
 	bool _paused;
 	uint32 _pauseStartTime;
 	uint32 _pauseTime;
+	// Time spent parsing and decoding frames of the current video, for the stats
+	uint32 _decodedFrames;
+	uint32 _decodeTime;
 	int16 _curVideoFlags = 0;
 	int _scrollX;
 	int _scrollY;
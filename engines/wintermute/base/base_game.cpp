@@ -409,6 +409,7 @@ bool BaseGame::cleanup() {
 		_scripts[i]->finish();
 	}
 	_scripts.removeAll();
+	scriptsChanged();
 
 	_fontStorage->removeFont(_systemFont);
 	_systemFont = nullptr;
@@ -39,6 +39,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(BaseScriptHolder, false)
 
+uint32 BaseScriptHolder::_scriptsGeneration = 0;
+
 //////////////////////////////////////////////////////////////////////
 BaseScriptHolder::BaseScriptHolder(BaseGame *inGame) : BaseScriptable(inGame) {
 	setName("<unnamed>");
@@ -63,6 +65,7 @@ bool BaseScriptHolder::cleanup() {
 		_scripts[i]->_owner = nullptr;
 	}
 	_scripts.removeAll();
+	scriptsChanged();
 
 	return STATUS_OK;
 }
@@ -290,6 +293,7 @@ bool BaseScriptHolder::persist(BasePersistenceManager *persistMgr) {
 		delete[] name;
 	}
 	_scripts.persist(persistMgr);
+	scriptsChanged();
 
 	return STATUS_OK;
 }
@@ -321,6 +325,7 @@ bool BaseScriptHolder::addScript(const char *filename) {
 			scr->_state = SCRIPT_ERROR;
 			scr->_owner = this;
 			_scripts.add(scr);
+			scriptsChanged();
 			_game->_scEngine->_scripts.add(scr);
 
 			return STATUS_OK;
@@ -329,6 +334,7 @@ bool BaseScriptHolder::addScript(const char *filename) {
 	} else {
 		scr->_freezable = _freezable;
 		_scripts.add(scr);
+		scriptsChanged();
 		return STATUS_OK;
 	}
 }
@@ -339,6 +345,7 @@ bool BaseScriptHolder::removeScript(ScScript *script) {
 	for (int32 i = 0; i < _scripts.getSize(); i++) {
 		if (_scripts[i] == script) {
 			_scripts.removeAt(i);
+			scriptsChanged();
 			break;
 		}
 	}
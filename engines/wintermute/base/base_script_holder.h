@@ -59,6 +59,11 @@ public:
 	bool _ready{};
 	BaseArray<ScScript *> _scripts;
 
+	// bumped whenever any holder's script list changes, so callers can cache canHandleMethod()
+	static uint32 getScriptsGeneration() {
+		return _scriptsGeneration;
+	}
+
 	// scripting interface
 	ScValue *scGetProperty(const char *name) override;
 	bool scSetProperty(const char *name, ScValue *value) override;
@@ -66,6 +71,14 @@ public:
 	const char *scToString() override;
 	void scDebuggerDesc(char *buf, int bufSize) override;
 
+protected:
+	static void scriptsChanged() {
+		_scriptsGeneration++;
+	}
+
+private:
+	static uint32 _scriptsGeneration;
+
 	// IWmeObject
 public:
 	virtual bool sendEvent(const char *eventName);
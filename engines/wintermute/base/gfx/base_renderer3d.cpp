@@ -22,6 +22,7 @@
 #include "engines/wintermute/base/gfx/base_renderer3d.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/gfx/3dutils.h"
+#include "engines/wintermute/wintermute.h"
 
 #include "common/config-manager.h"
 
@@ -44,6 +45,11 @@ BaseRenderer3D::BaseRenderer3D(Wintermute::BaseGame *inGame) : BaseRenderer(inGa
 	DXMatrixIdentity(&_worldMatrix);
 	DXMatrixIdentity(&_viewMatrix);
 	DXMatrixIdentity(&_projectionMatrix);
+
+	_statMeshesSkinned = 0;
+	_statMeshesReused = 0;
+	_statAnimTime = 0;
+	_statStartTime = 0;
 }
 
 BaseRenderer3D::~BaseRenderer3D() {
@@ -53,6 +59,18 @@ BaseRenderer3D::~BaseRenderer3D() {
 void BaseRenderer3D::initLoop() {
 	BaseRenderer::initLoop();
 	setup2D();
+
+	uint32 now = g_system->getMillis();
+	if (now - _statStartTime >= 1000) {
+		if (_statMeshesSkinned || _statMeshesReused) {
+			debugC(1, kWintermuteDebug3D, "BaseRenderer3D: %u meshes skinned, %u reused, %u ms animating models in %u ms",
+			       _statMeshesSkinned, _statMeshesReused, _statAnimTime, now - _statStartTime);
+		}
+		_statMeshesSkinned = 0;
+		_statMeshesReused = 0;
+		_statAnimTime = 0;
+		_statStartTime = now;
+	}
 }
 
 bool BaseRenderer3D::drawSprite(BaseSurface *texture, const Common::Rect32 &rect,
@@ -94,6 +94,12 @@ public:
 	void initLoop() override;
 	bool windowedBlt() override;
 
+	// 3D model statistics for the "3d" debug channel, reported by initLoop() once a second
+	uint32 _statMeshesSkinned;
+	uint32 _statMeshesReused;
+	uint32 _statAnimTime;
+	uint32 _statStartTime;
+
 	virtual bool startSpriteBatch() override = 0;
 	virtual bool endSpriteBatch() override = 0;
 	virtual bool commitSpriteBatch() = 0;
@@ -33,6 +33,7 @@
 #include "engines/wintermute/math/math_util.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/wintermute.h"
 #include "engines/util.h"
 
 #include "common/system.h"
@@ -41,7 +42,8 @@
 
 #include "graphics/cursorman.h"
 
-#define DIRTY_RECT_LIMIT 800
+// Past this many separate dirty rects, they are merged into their bounding box
+#define DIRTY_RECT_LIMIT 16
 
 namespace Wintermute {
 
@@ -58,7 +60,6 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -73,11 +74,9 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 	while (it != _renderQueue.end()) {
 		RenderTicket *ticket = *it;
 		it = _renderQueue.erase(it);
-		delete ticket;
+		deleteTicket(ticket);
 	}
 
-	delete _dirtyRect;
-
 	_renderSurface->free();
 	delete _renderSurface;
 }
@@ -150,8 +149,7 @@ bool BaseRenderOSystem::forcedFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -161,6 +159,7 @@ bool BaseRenderOSystem::flip() {
 		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 			(*it)->_wantsDraw = false;
 		}
+		rebuildTicketIndex();
 
 		addDirtyRect(_renderRect);
 		return true;
@@ -174,7 +173,7 @@ bool BaseRenderOSystem::flip() {
 			if ((*it)->_wantsDraw == false) {
 				RenderTicket *ticket = *it;
 				it = _renderQueue.erase(it);
-				delete ticket;
+				deleteTicket(ticket);
 			} else {
 				(*it)->_wantsDraw = false;
 				++it;
@@ -190,12 +189,15 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen(_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
 
+	if (!_disableDirtyRects) {
+		rebuildTicketIndex();
+	}
+
 	g_system->updateScreen();
 
 	return STATUS_OK;
@@ -260,7 +262,7 @@ Graphics::PixelFormat BaseRenderOSystem::getPixelFormat() const {
 void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
                                     Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
 	if (_disableDirtyRects) {
-		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
+		RenderTicket *ticket = new (_ticketPool) RenderTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
 		drawFromSurface(ticket);
@@ -274,25 +276,13 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
-				}
-				return;
-			}
+		RenderQueueIterator it;
+		if (findQueuedTicket(compare, it)) {
+			drawFromQueuedTicket(it);
+			return;
 		}
 	}
-	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
+	RenderTicket *ticket = new (_ticketPool) RenderTicket(owner, surf, srcRect, dstRect, transform);
 	if (!_disableDirtyRects) {
 		drawFromTicket(ticket);
 	} else {
@@ -302,6 +292,59 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	}
 }
 
+static uint32 ticketHash(const RenderTicket &ticket) {
+	uint32 hash = (uint32)(uintptr)ticket._owner;
+	const Common::Rect *src = ticket.getSrcRect();
+	hash = hash * 31 + (uint16)ticket._dstRect.left;
+	hash = hash * 31 + (uint16)ticket._dstRect.top;
+	hash = hash * 31 + (uint16)ticket._dstRect.right;
+	hash = hash * 31 + (uint16)ticket._dstRect.bottom;
+	hash = hash * 31 + (uint16)src->left;
+	hash = hash * 31 + (uint16)src->top;
+	hash = hash * 31 + (uint16)src->right;
+	hash = hash * 31 + (uint16)src->bottom;
+	return hash;
+}
+
+bool BaseRenderOSystem::findQueuedTicket(const RenderTicket &compare, RenderQueueIterator &found) {
+	Common::HashMap<uint32, Common::Array<IndexedTicket> >::iterator bucket = _ticketIndex.find(ticketHash(compare));
+	if (bucket == _ticketIndex.end()) {
+		return false;
+	}
+
+	// Tickets that were drawn this frame already are exactly the ones that
+	// have been placed up to _lastFrameIter, so skipping them gives the same
+	// result as searching the queue from _lastFrameIter onwards. Their
+	// iterators may be stale, as they can have been re-queued.
+	Common::Array<IndexedTicket> &candidates = bucket->_value;
+	for (uint i = 0; i < candidates.size(); i++) {
+		RenderTicket *ticket = candidates[i].ticket;
+		if (!ticket->_wantsDraw && ticket->_isValid && *ticket == compare) {
+			found = candidates[i].it;
+			return true;
+		}
+	}
+	return false;
+}
+
+void BaseRenderOSystem::rebuildTicketIndex() {
+	_ticketIndex.clear();
+
+	for (RenderQueueIterator it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		if (!(*it)->_owner) {
+			continue;
+		}
+		IndexedTicket entry;
+		entry.ticket = *it;
+		entry.it = it;
+		_ticketIndex[ticketHash(**it)].push_back(entry);
+	}
+}
+
+void BaseRenderOSystem::deleteTicket(RenderTicket *ticket) {
+	_ticketPool.deleteChunk(ticket);
+}
+
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 	addDirtyRect(renderTicket->_dstRect);
 	renderTicket->_isValid = false;
@@ -354,12 +397,34 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirty(rect);
+	dirty.clip(_renderRect);
+	if (dirty.isEmpty()) {
+		return;
+	}
+
+	// Keep the rects disjoint, so no pixel is drawn twice: swallow everything
+	// overlapping the new rect, and start over whenever it grows.
+	for (uint i = 0; i < _dirtyRects.size();) {
+		if (_dirtyRects[i].contains(dirty)) {
+			return;
+		}
+		if (_dirtyRects[i].intersects(dirty)) {
+			dirty.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+	_dirtyRects.push_back(dirty);
+
+	if (_dirtyRects.size() > DIRTY_RECT_LIMIT) {
+		for (uint i = 1; i < _dirtyRects.size(); i++) {
+			_dirtyRects[0].extend(_dirtyRects[i]);
+		}
+		_dirtyRects.resize(1);
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -373,12 +438,12 @@ void BaseRenderOSystem::drawTickets() {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
 			it = _renderQueue.erase(it);
-			delete ticket;
+			deleteTicket(ticket);
 		} else {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -388,29 +453,66 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
+
+	uint32 dirtyPixels = 0;
+	uint32 drawnPixels = 0;
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+		drawnPixels += drawDirtyRect(dirtyRect);
+		dirtyPixels += dirtyRect.width() * dirtyRect.height();
+		g_system->copyRectToScreen(_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+	}
+
+	debugC(2, kWintermuteDebugRender, "BaseRenderOSystem::drawTickets(): %d dirty rects, %d dirty pixels, %d pixels drawn, %d tickets",
+	       _dirtyRects.size(), dirtyPixels, drawnPixels, _renderQueue.size());
+
+	it = _renderQueue.begin();
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
+	for (; it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
+	}
+
+	it = _renderQueue.begin();
+	// Clean out the old tickets
+	while (it != _renderQueue.end()) {
+		if ((*it)->_isValid == false) {
+			RenderTicket *ticket = *it;
+			addDirtyRect((*it)->_dstRect);
+			it = _renderQueue.erase(it);
+			deleteTicket(ticket);
+		} else {
+			++it;
+		}
+	}
+
+}
+
+uint32 BaseRenderOSystem::drawDirtyRect(const Common::Rect &dirtyRect) {
+	RenderQueueIterator it = _renderQueue.begin();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
+	if (it != _renderQueue.end() && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
 		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		if (!(*it)->_dstRect.contains(dirtyRect)) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
 		// Otherwise Do NOT fill.
 	} else {
 		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
+		_renderSurface->fillRect(dirtyRect, _clearColor);
 	}
+
+	uint32 drawnPixels = 0;
 	for (; it != _renderQueue.end(); ++it) {
 		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
+		if (ticket->_dstRect.intersects(dirtyRect)) {
 			// dstClip is the area we want redrawn.
 			Common::Rect dstClip(ticket->_dstRect);
 			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
+			dstClip.clip(dirtyRect);
 			// we need to keep track of the position to redraw the dirty rect
 			Common::Rect pos(dstClip);
 			int16 offsetX = ticket->_dstRect.left;
@@ -419,26 +521,11 @@ void BaseRenderOSystem::drawTickets() {
 			dstClip.translate(-offsetX, -offsetY);
 
 			drawFromSurface(ticket, &pos, &dstClip);
+			drawnPixels += pos.width() * pos.height();
 			_needsFlip = true;
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
-		ticket->_wantsDraw = false;
-	}
-	g_system->copyRectToScreen(_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-
-	it = _renderQueue.begin();
-	// Clean out the old tickets
-	while (it != _renderQueue.end()) {
-		if ((*it)->_isValid == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
-		} else {
-			++it;
-		}
 	}
-
+	return drawnPixels;
 }
 
 // Replacement for SDL2's SDL_RenderCopy
@@ -559,8 +646,9 @@ void BaseRenderOSystem::endSaveLoad() {
 	while (it != _renderQueue.end()) {
 		RenderTicket *ticket = *it;
 		it = _renderQueue.erase(it);
-		delete ticket;
+		deleteTicket(ticket);
 	}
+	_ticketIndex.clear();
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
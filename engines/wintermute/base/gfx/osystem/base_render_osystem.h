@@ -29,16 +29,18 @@
 #define WINTERMUTE_BASE_RENDERER_SDL_H
 
 #include "engines/wintermute/base/gfx/base_renderer.h"
+#include "engines/wintermute/base/gfx/osystem/render_ticket.h"
 
 #include "common/rect.h"
 #include "common/list.h"
+#include "common/hashmap.h"
+#include "common/memorypool.h"
 
 #include "graphics/managed_surface.h"
 #include "graphics/transform_struct.h"
 
 namespace Wintermute {
 class BaseSurfaceOSystem;
-class RenderTicket;
 /**
  * A 2D-renderer implementation for WME.
  * This renderer makes use of a "ticket"-system, where all draw-calls
@@ -124,13 +126,38 @@ private:
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Redraw all tickets that intersect a single dirty rect
+	 * @return the number of pixels drawn
+	 */
+	uint32 drawDirtyRect(const Common::Rect &dirtyRect);
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	/**
+	 * Find the first ticket from last frame, that has not been
+	 * drawn again yet, matching the given one.
+	 */
+	bool findQueuedTicket(const RenderTicket &compare, RenderQueueIterator &found);
+	/**
+	 * Index the tickets from this frame, so the next frame can find them.
+	 */
+	void rebuildTicketIndex();
+	void deleteTicket(RenderTicket *ticket);
+
+	// Disjoint regions of the screen that need redrawing
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
 
+	struct IndexedTicket {
+		RenderTicket *ticket;
+		RenderQueueIterator it;
+	};
+	// Tickets from last frame, hashed by owner and rects, in queue order
+	Common::HashMap<uint32, Common::Array<IndexedTicket> > _ticketIndex;
+	Common::ObjectPool<RenderTicket> _ticketPool;
+
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
 	Common::Rect _renderRect;
@@ -26,6 +26,7 @@
  */
 
 #include "engines/wintermute/base/gfx/3dshadow_volume.h"
+#include "engines/wintermute/base/gfx/base_renderer3d.h"
 #include "engines/wintermute/base/gfx/xmaterial.h"
 #include "engines/wintermute/base/gfx/xmesh.h"
 #include "engines/wintermute/base/gfx/skin_mesh_helper.h"
@@ -37,6 +38,7 @@
 #include "engines/wintermute/base/gfx/3deffect.h"
 #include "engines/wintermute/base/gfx/3dutils.h"
 #include "engines/wintermute/base/base_engine.h"
+#include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/utils/path_util.h"
 #include "engines/wintermute/dcgf.h"
 
@@ -52,6 +54,9 @@ XMesh::XMesh(Wintermute::BaseGame *inGame) : BaseNamedObject(inGame) {
 	_boneMatrices = nullptr;
 	_adjacency = nullptr;
 
+	_cachedMatrices = nullptr;
+	_cachedMatricesValid = false;
+
 	_BBoxStart = _BBoxEnd = DXVector3(0.0f, 0.0f, 0.0f);
 }
 
@@ -62,6 +67,7 @@ XMesh::~XMesh() {
 
 	SAFE_DELETE_ARRAY(_boneMatrices);
 	SAFE_DELETE_ARRAY(_adjacency);
+	SAFE_DELETE_ARRAY(_cachedMatrices);
 
 	_materials.removeAll();
 }
@@ -93,12 +99,15 @@ bool XMesh::loadFromXData(const char *filename, XFileData *xobj) {
 	if (numBones) {
 		// bones are available
 		_boneMatrices = new DXMatrix*[numBones];
+		_cachedMatrices = new DXMatrix[numBones];
 
 		generateMesh();
 	} else {
 		// no bones are found, blend the mesh and use it as a static mesh
 		_skinMesh->getOriginalMesh(&_staticMesh);
 		_staticMesh->cloneMesh(&_blendedMesh);
+		_cachedMatrices = new DXMatrix[1];
+		_cachedMatricesValid = false;
 
 		SAFE_DELETE(_skinMesh);
 
@@ -148,6 +157,7 @@ bool XMesh::generateMesh() {
 	uint32 numFaces = _skinMesh->getNumFaces();
 
 	SAFE_DELETE(_blendedMesh);
+	_cachedMatricesValid = false;
 
 	SAFE_DELETE_ARRAY(_adjacency);
 	_adjacency = new uint32[numFaces * 3];
@@ -187,19 +197,33 @@ bool XMesh::update(FrameNode *parentFrame) {
 	if (!_blendedMesh)
 		return false;
 
+	BaseRenderer3D *renderer = _game->_renderer3D;
+
 	// update skinned mesh
 	if (_skinMesh) {
 		int numBones = _skinMesh->getNumBones();
-		DXMatrix *boneMatrices = new DXMatrix[numBones];
+		bool changed = !_cachedMatricesValid;
 
 		// prepare final matrices
 		for (int i = 0; i < numBones; i++) {
-			DXMatrixMultiply(&boneMatrices[i], _skinMesh->getBoneOffsetMatrix(i), _boneMatrices[i]);
+			DXMatrix boneMatrix;
+			DXMatrixMultiply(&boneMatrix, _skinMesh->getBoneOffsetMatrix(i), _boneMatrices[i]);
+			if (changed || memcmp(&boneMatrix, &_cachedMatrices[i], sizeof(DXMatrix)) != 0) {
+				_cachedMatrices[i] = boneMatrix;
+				changed = true;
+			}
 		}
 
+		// the pose didn't change since the last skinning, nor did the bounding box
+		if (!changed) {
+			renderer->_statMeshesReused++;
+			return true;
+		}
+		_cachedMatricesValid = true;
+		renderer->_statMeshesSkinned++;
+
 		// generate skinned mesh
-		_skinMesh->updateSkinnedMesh(boneMatrices, _blendedMesh);
-		delete[] boneMatrices;
+		_skinMesh->updateSkinnedMesh(_cachedMatrices, _blendedMesh);
 
 		// update mesh bounding box
 		byte *points = _blendedMesh->getVertexBuffer().ptr();
@@ -234,6 +258,15 @@ bool XMesh::update(FrameNode *parentFrame) {
 			_BBoxEnd = DXVector3(maxX, maxY, maxZ);
 		}
 	} else {
+		DXMatrix *frameMatrix = parentFrame->getCombinedMatrix();
+		if (_cachedMatricesValid && memcmp(frameMatrix, &_cachedMatrices[0], sizeof(DXMatrix)) == 0) {
+			renderer->_statMeshesReused++;
+			return true;
+		}
+		_cachedMatrices[0] = *frameMatrix;
+		_cachedMatricesValid = true;
+		renderer->_statMeshesSkinned++;
+
 		// update static mesh
 		uint32 fvfSize = DXGetFVFVertexSize(_blendedMesh->getFVF());
 		uint32 numVertices = _blendedMesh->getNumVertices();
@@ -247,7 +280,7 @@ bool XMesh::update(FrameNode *parentFrame) {
 		for (uint32 i = 0; i < numVertices; i++) {
 			DXVector3 v = *(DXVector3 *)(oldPoints + i * fvfSize);
 			DXVector4 newVertex;
-			DXVec3Transform(&newVertex, &v, parentFrame->getCombinedMatrix());
+			DXVec3Transform(&newVertex, &v, frameMatrix);
 
 			((DXVector3 *)(newPoints + i * fvfSize))->_x = newVertex._x;
 			((DXVector3 *)(newPoints + i * fvfSize))->_y = newVertex._y;
@@ -80,6 +80,11 @@ protected:
 
 	DXMatrix **_boneMatrices;
 
+	// final bone matrices (or the frame matrix of a static mesh) _blendedMesh was
+	// last computed with; the vertices are left alone while these don't change
+	DXMatrix *_cachedMatrices;
+	bool _cachedMatricesValid;
+
 	uint32 *_adjacency;
 
 	BaseArray<Material *> _materials;
@@ -359,6 +359,8 @@ bool XModel::loadName(Common::String &targetStr, XFileData *data) {
 
 //////////////////////////////////////////////////////////////////////////
 bool XModel::update() {
+	uint32 startTime = g_system->getMillis();
+
 	// reset all bones to default position
 	reset();
 
@@ -373,7 +375,9 @@ bool XModel::update() {
 		DXMatrixIdentity(&tempMat);
 		_rootFrame->updateMatrices(&tempMat);
 
-		return _rootFrame->updateMeshes();
+		bool res = _rootFrame->updateMeshes();
+		_game->_renderer3D->_statAnimTime += g_system->getMillis() - startTime;
+		return res;
 	} else {
 		return false;
 	}
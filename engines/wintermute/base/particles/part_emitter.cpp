@@ -31,6 +31,7 @@
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_region.h"
+#include "engines/wintermute/base/base_sprite.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/gfx/base_renderer.h"
@@ -89,6 +90,9 @@ PartEmitter::PartEmitter(BaseGame *inGame, BaseScriptHolder *owner) : BaseObject
 
 	_useRegion = false;
 
+	_globalForce = DXVector2(0.0f, 0.0f);
+	_numPointForces = 0;
+
 	_emitEvent = nullptr;
 	_owner = owner;
 }
@@ -101,6 +105,11 @@ PartEmitter::~PartEmitter() {
 	}
 	_particles.removeAll();
 
+	for (int32 i = 0; i < _spritePool.getSize(); i++) {
+		delete _spritePool[i];
+	}
+	_spritePool.removeAll();
+
 	for (int32 i = 0; i < _forces.getSize(); i++) {
 		delete _forces[i];
 	}
@@ -234,7 +243,7 @@ bool PartEmitter::initParticle(PartParticle *particle, uint32 currentTime, uint3
 	particle->_angVelocity = angVelocity;
 	particle->_growthRate = growthRate;
 	particle->_exponentialGrowth = _exponentialGrowth;
-	particle->_isDead = DID_FAIL(particle->setSprite(_sprites[spriteIndex]));
+	particle->_isDead = DID_FAIL(setParticleSprite(particle, _sprites[spriteIndex]));
 	particle->fadeIn(currentTime, _fadeInTime);
 
 
@@ -245,6 +254,45 @@ bool PartEmitter::initParticle(PartParticle *particle, uint32 currentTime, uint3
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool PartEmitter::setParticleSprite(PartParticle *particle, const char *filename) {
+	BaseSprite *sprite = particle->_sprite;
+	if (sprite && sprite->_filename && scumm_stricmp(filename, sprite->_filename) == 0) {
+		sprite->reset();
+		return STATUS_OK;
+	}
+
+	// park the current sprite, another particle may want it later
+	if (sprite) {
+		if (_spritePool.getSize() >= MAX(_sprites.getSize(), 4) * 2) {
+			delete _spritePool[0];
+			_spritePool.removeAt(0);
+		}
+		_spritePool.add(sprite);
+		particle->_sprite = nullptr;
+	}
+
+	for (int32 i = _spritePool.getSize() - 1; i >= 0; i--) {
+		sprite = _spritePool[i];
+		if (sprite->_filename && scumm_stricmp(filename, sprite->_filename) == 0) {
+			_spritePool.removeAt(i);
+			sprite->reset();
+			particle->_sprite = sprite;
+			return STATUS_OK;
+		}
+	}
+
+	return particle->setSprite(filename);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void PartEmitter::releaseParticles() {
+	// keep the objects and their sprites around for the next start()
+	for (int32 i = 0; i < _particles.getSize(); i++) {
+		_particles[i]->_isDead = true;
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::update() {
 	if (!_running) {
@@ -258,7 +306,22 @@ bool PartEmitter::update() {
 bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 	int numLive = 0;
 
+	_globalForce = DXVector2(0.0f, 0.0f);
+	_numPointForces = 0;
+	for (int32 i = 0; i < _forces.getSize(); i++) {
+		if (_forces[i]->_type == PartForce::FORCE_GLOBAL) {
+			_globalForce += _forces[i]->_direction;
+		} else if (_forces[i]->_type == PartForce::FORCE_POINT) {
+			_numPointForces++;
+		}
+	}
+
 	for (int32 i = 0; i < _particles.getSize(); i++) {
+		// dead particles only wait to be reused
+		if (_particles[i]->_isDead) {
+			continue;
+		}
+
 		_particles[i]->update(this, currentTime, timerDelta);
 
 		if (!_particles[i]->_isDead) {
@@ -279,14 +342,13 @@ bool PartEmitter::updateInternal(uint32 currentTime, uint32 timerDelta) {
 			}
 
 			int toGen = MIN(_genAmount, _maxParticles - numLive);
+			int32 nextDead = 0;
 			while (toGen > 0) {
-				int32 firstDeadIndex = -1;
-				for (int32 i = 0; i < _particles.getSize(); i++) {
-					if (_particles[i]->_isDead) {
-						firstDeadIndex = i;
-						break;
-					}
+				// particles before the previous pick are all alive by now
+				while (nextDead < _particles.getSize() && !_particles[nextDead]->_isDead) {
+					nextDead++;
 				}
+				int32 firstDeadIndex = nextDead < _particles.getSize() ? nextDead : -1;
 
 				PartParticle *particle;
 				if (firstDeadIndex >= 0) {
@@ -323,6 +385,10 @@ bool PartEmitter::display(BaseRegion *region) {
 	}
 
 	for (int32 i = 0; i < _particles.getSize(); i++) {
+		if (_particles[i]->_isDead) {
+			continue;
+		}
+
 		if (region != nullptr && _useRegion) {
 			if (!region->pointInRegion((int)_particles[i]->_pos._x, (int)_particles[i]->_pos._y)) {
 				continue;
@@ -341,9 +407,7 @@ bool PartEmitter::display(BaseRegion *region) {
 
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::start() {
-	for (int32 i = 0; i < _particles.getSize(); i++) {
-		_particles[i]->_isDead = true;
-	}
+	releaseParticles();
 	_running = true;
 	_batchesGenerated = 0;
 
@@ -525,10 +589,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	else if (strcmp(name, "Stop") == 0) {
 		stack->correctParams(0);
 
-		for (int32 i = 0; i < _particles.getSize(); i++) {
-			delete _particles[i];
-		}
-		_particles.removeAll();
+		releaseParticles();
 
 		_running = false;
 		stack->pushBool(true);
@@ -34,6 +34,7 @@
 
 namespace Wintermute {
 class BaseRegion;
+class BaseSprite;
 class PartParticle;
 class PartEmitter : public BaseObject {
 public:
@@ -116,6 +117,10 @@ public:
 
 	BaseArray<PartForce *> _forces;
 
+	// sum of all global forces and number of point forces, refreshed each update
+	DXVector2 _globalForce;
+	int32 _numPointForces;
+
 	// scripting interface
 	ScValue *scGetProperty(const char *name) override;
 	bool scSetProperty(const char *name, ScValue *value) override;
@@ -126,10 +131,14 @@ private:
 	PartForce *addForceByName(const char *name);
 	static int32 compareZ(const void *obj1, const void *obj2);
 	bool initParticle(PartParticle *particle, uint32 currentTime, uint32 timerDelta);
+	bool setParticleSprite(PartParticle *particle, const char *filename);
+	void releaseParticles();
 	bool updateInternal(uint32 currentTime, uint32 timerDelta);
 	uint32 _lastGenTime;
 	BaseArray<PartParticle *> _particles;
 	BaseArray<char *> _sprites;
+	// sprites taken from reused particles, handed out again to particles wanting the same file
+	BaseArray<BaseSprite *> _spritePool;
 };
 
 } // End of namespace Wintermute
@@ -147,26 +147,21 @@ bool PartParticle::update(PartEmitter *emitter, uint32 currentTime, uint32 timer
 		// update position
 		float elapsedTime = (float)timerDelta / 1000.f;
 
-		for (int32 i = 0; i < emitter->_forces.getSize(); i++) {
+		// global forces were summed up by the emitter, only point forces depend on the position
+		_velocity += emitter->_globalForce * elapsedTime;
+
+		for (int32 i = 0; i < emitter->_forces.getSize() && emitter->_numPointForces > 0; i++) {
 			PartForce *force = emitter->_forces[i];
-			switch (force->_type) {
-			case PartForce::FORCE_GLOBAL:
-				_velocity += force->_direction * elapsedTime;
-				break;
+			if (force->_type != PartForce::FORCE_POINT) {
+				continue;
+			}
 
-			case PartForce::FORCE_POINT: {
-				DXVector2 vecDist = force->_pos - _pos;
-				float dist = fabs(DXVec2Length(&vecDist));
+			DXVector2 vecDist = force->_pos - _pos;
+			float dist = fabs(DXVec2Length(&vecDist));
 
-				dist = 100.0f / dist;
+			dist = 100.0f / dist;
 
-				_velocity += force->_direction * dist * elapsedTime;
-			}
-			break;
-
-			default:
-				break;
-			}
+			_velocity += force->_direction * dist * elapsedTime;
 		}
 		_pos += _velocity * elapsedTime;
 
@@ -29,6 +29,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_engine.h"
+#include "engines/wintermute/base/base_script_holder.h"
 #include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/gfx/base_renderer.h"
@@ -59,6 +60,7 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 
 	_symbols = nullptr;
 	_numSymbols = 0;
+	_symbolCache = nullptr;
 
 	_engine = engine;
 
@@ -194,6 +196,15 @@ bool ScScript::initTables() {
 		_symbols[index] = getString();
 	}
 
+	_symbolCache = new TSymbolCache[_numSymbols];
+	for (uint32 i = 0; i < _numSymbols; i++) {
+		_symbolCache[i].key = _symbols[i];
+		_symbolCache[i].global = nullptr;
+		_symbolCache[i].globalsVersion = 0;
+		_symbolCache[i].engineGlobalsVersion = 0;
+	}
+	_methodCache.clear();
+
 	// load functions table
 	_iP = _header.funcTable;
 
@@ -400,6 +411,10 @@ void ScScript::cleanup() {
 	_symbols = nullptr;
 	_numSymbols = 0;
 
+	delete[] _symbolCache;
+	_symbolCache = nullptr;
+	_methodCache.clear();
+
 	if (_globals && !_thread) {
 		delete _globals;
 	}
@@ -612,10 +627,8 @@ bool ScScript::executeInstruction() {
 	case II_CALL_BY_EXP: {
 		// push var
 		// push string
-		str = _stack->pop()->getString();
-		size_t methodNameSize = strlen(str) + 1;
-		char *methodName = new char[methodNameSize];
-		Common::strcpy_s(methodName, methodNameSize, str);
+		Common::String methodNameStr(_stack->pop()->getString());
+		const char *methodName = methodNameStr.c_str();
 
 		ScValue *var = _stack->pop();
 		if (var->_type == VAL_VARIABLE_REF) {
@@ -643,11 +656,10 @@ bool ScScript::executeInstruction() {
 
 				_stack->correctParams(0);
 				_stack->pushNULL();
-				delete[] methodName;
 				break;
 			}
 
-			if (var->isNative() && var->getNative()->canHandleMethod(methodName)) {
+			if (var->isNative() && nativeCanHandleMethod(_iP, var->getNative(), methodName)) {
 				if (!_unbreakable) {
 					_waitScript = var->getNative()->invokeMethodThread(methodName);
 					if (!_waitScript) {
@@ -670,7 +682,6 @@ bool ScScript::executeInstruction() {
 					runtimeError("Cannot call method '%s'. Ignored.", methodName);
 					_stack->pushNULL();
 				}
-				delete[] methodName;
 				break;
 			}
 			/*
@@ -715,7 +726,6 @@ bool ScScript::executeInstruction() {
 				}
 			}
 		}
-		delete[] methodName;
 	}
 	break;
 
@@ -751,7 +761,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(getDWORD());
 		// Disabled in original code
 		/*if (false && var->_type==VAL_OBJECT || var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
@@ -763,15 +773,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(getDWORD());
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getVar(getDWORD());
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -822,7 +831,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getVar(getDWORD()));
 		_thisStack->push(_operand);
 		break;
 
@@ -1224,6 +1233,55 @@ ScValue *ScScript::getVar(char *name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScScript::getVar(uint32 symbol) {
+	TSymbolCache &sym = _symbolCache[symbol];
+
+	// scope locals come and go with every call, always look them up
+	if (_scopeStack->_sP >= 0) {
+		ScValue *ret = _scopeStack->getTop()->findProp(sym.key);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	// globals only need resolving again once a property was added or removed
+	uint32 globalsVersion = _globals->getPropsVersion();
+	uint32 engineGlobalsVersion = _engine->_globals->getPropsVersion();
+	if (sym.global && sym.globalsVersion == globalsVersion && sym.engineGlobalsVersion == engineGlobalsVersion) {
+		return sym.global;
+	}
+
+	ScValue *ret = _globals->findProp(sym.key);
+	if (ret == nullptr) {
+		ret = _engine->_globals->findProp(sym.key);
+	}
+	if (ret == nullptr) {
+		return getVar(_symbols[symbol]);
+	}
+
+	sym.global = ret;
+	sym.globalsVersion = globalsVersion;
+	sym.engineGlobalsVersion = engineGlobalsVersion;
+	return ret;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool ScScript::nativeCanHandleMethod(uint32 site, BaseScriptable *native, const char *methodName) {
+	uint32 generation = BaseScriptHolder::getScriptsGeneration();
+
+	TMethodCache &entry = _methodCache.getOrCreateVal(site);
+	if (entry.native != native || entry.generation != generation || entry.methodName != methodName) {
+		entry.native = native;
+		entry.generation = generation;
+		entry.methodName = methodName;
+		entry.canHandle = native->canHandleMethod(methodName);
+	}
+	return entry.canHandle;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::waitFor(BaseObject *object) {
 	if (_unbreakable) {
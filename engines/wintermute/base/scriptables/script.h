@@ -36,6 +36,7 @@
 
 namespace Wintermute {
 class BaseScriptHolder;
+class BaseScriptable;
 class BaseObject;
 class ScEngine;
 class ScStack;
@@ -78,6 +79,7 @@ public:
 	TScriptState _state;
 	TScriptState _origState;
 	ScValue *getVar(char *name);
+	ScValue *getVar(uint32 symbol);
 	uint32 getFuncPos(const char *name);
 	uint32 getEventPos(const char *name);
 	uint32 getMethodPos(const char *name);
@@ -161,6 +163,27 @@ private:
 	bool initScript();
 	bool initTables();
 
+	// symbol names hashed once per load, plus the global they last resolved to
+	typedef struct {
+		Common::String key;
+		ScValue *global;
+		uint32 globalsVersion;
+		uint32 engineGlobalsVersion;
+	} TSymbolCache;
+
+	TSymbolCache *_symbolCache;
+
+	// canHandleMethod() result remembered per II_CALL_BY_EXP site
+	typedef struct {
+		BaseScriptable *native;
+		uint32 generation;
+		Common::String methodName;
+		bool canHandle;
+	} TMethodCache;
+
+	Common::HashMap<uint32, TMethodCache> _methodCache;
+	bool nativeCanHandleMethod(uint32 site, BaseScriptable *native, const char *methodName);
+
 	virtual void preInstHook(uint32 inst);
 	virtual void postInstHook(uint32 inst);
 
@@ -34,8 +34,11 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/utils/utils.h"
 #include "engines/wintermute/platform_osystem.h"
+#include "engines/wintermute/wintermute.h"
 #include "engines/wintermute/dcgf.h"
 
+#include "common/algorithm.h"
+
 namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScEngine, true)
@@ -76,14 +79,17 @@ ScEngine::ScEngine(BaseGame *inGame) : BaseClass(inGame) {
 	}
 
 	// prepare script cache
-	for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-		_cachedScripts[i] = nullptr;
-	}
+	_cachedScriptsSize = 0;
+	_cacheClock = 0;
 
 	_currentScript = nullptr;
 
 	_isProfiling = false;
 	_profilingStartTime = 0;
+	_profilingInstructions = 0;
+
+	_statsInstructions = 0;
+	_statsStartTime = 0;
 
 	//enableProfiling();
 }
@@ -200,15 +206,17 @@ bool ScEngine::isRunningScript(const char *filename) {
 byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache) {
 	// is script in cache?
 	if (!ignoreCache) {
-		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-			if (_cachedScripts[i] && scumm_stricmp(_cachedScripts[i]->_filename, filename) == 0) {
-				_cachedScripts[i]->_timestamp = BasePlatform::getTime();
-				*outSize = _cachedScripts[i]->_size;
-				return _cachedScripts[i]->_buffer;
-			}
+		CachedScripts::iterator it = _cachedScripts.find(filename);
+		if (it != _cachedScripts.end()) {
+			it->_value->_timestamp = ++_cacheClock;
+			*outSize = it->_value->_size;
+			return it->_value->_buffer;
 		}
 	}
 
+	debugC(2, kWintermuteDebugScript, "ScEngine::getCompiledScript(): loading '%s' (%d scripts, %u bytes cached)",
+	       filename, _cachedScripts.size(), _cachedScriptsSize);
+
 	// nope, load it
 	byte *compBuffer;
 	uint32 compSize;
@@ -241,22 +249,17 @@ byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ig
 	// add script to cache
 	CScCachedScript *cachedScript = new CScCachedScript(filename, compBuffer, compSize);
 	if (cachedScript) {
-		int index = 0;
-		uint32 minTime = BasePlatform::getTime();
-		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-			if (_cachedScripts[i] == nullptr) {
-				index = i;
-				break;
-			} else if (_cachedScripts[i]->_timestamp <= minTime) {
-				minTime = _cachedScripts[i]->_timestamp;
-				index = i;
-			}
-		}
+		cachedScript->_timestamp = ++_cacheClock;
 
-		if (_cachedScripts[index] != nullptr) {
-			delete _cachedScripts[index];
+		CachedScripts::iterator it = _cachedScripts.find(filename);
+		if (it != _cachedScripts.end()) {
+			_cachedScriptsSize -= it->_value->_size;
+			delete it->_value;
 		}
-		_cachedScripts[index] = cachedScript;
+		_cachedScripts[filename] = cachedScript;
+		_cachedScriptsSize += compSize;
+
+		trimScriptCache(cachedScript);
 
 		ret = cachedScript->_buffer;
 		*outSize = cachedScript->_size;
@@ -343,6 +346,7 @@ bool ScEngine::tick() {
 
 
 	// execute scripts
+	uint32 instructions = 0;
 	for (int32 i = 0; i < _scripts.getSize(); i++) {
 
 		// skip paused scripts
@@ -356,6 +360,7 @@ bool ScEngine::tick() {
 			while (_scripts[i]->_state == SCRIPT_RUNNING && BasePlatform::getTime() - startTime < _scripts[i]->_timeSlice) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
 			if (_isProfiling && _scripts[i]->_filename && _scripts[i]->_filename[0]) {
 				addScriptTime(_scripts[i]->_filename, BasePlatform::getTime() - startTime);
@@ -373,6 +378,7 @@ bool ScEngine::tick() {
 			while (_scripts[i]->_state == SCRIPT_RUNNING) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				instructions++;
 			}
 			if (isProfiling && _scripts[i]->_filename && _scripts[i]->_filename[0]) {
 				addScriptTime(_scripts[i]->_filename, BasePlatform::getTime() - startTime);
@@ -383,10 +389,38 @@ bool ScEngine::tick() {
 
 	removeFinishedScripts();
 
+	reportStats(instructions);
+
 	return STATUS_OK;
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::reportStats(uint32 instructions) {
+	if (_isProfiling) {
+		_profilingInstructions += instructions;
+	}
+
+	if (!debugChannelSet(1, kWintermuteDebugScript)) {
+		return;
+	}
+
+	uint32 now = BasePlatform::getTime();
+	if (_statsStartTime == 0) {
+		_statsStartTime = now;
+	}
+	_statsInstructions += instructions;
+
+	uint32 elapsed = now - _statsStartTime;
+	if (elapsed >= 1000) {
+		debugC(1, kWintermuteDebugScript, "ScEngine::tick(): %u instructions in %u ms (%u/s), %d scripts",
+		       _statsInstructions, elapsed, (uint32)((uint64)_statsInstructions * 1000 / elapsed), _scripts.getSize());
+		_statsInstructions = 0;
+		_statsStartTime = now;
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::tickUnbreakable() {
 	ScScript *oldScript = _currentScript;
@@ -472,15 +506,34 @@ int ScEngine::getNumScripts(int *running, int *waiting, int *persistent) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::emptyScriptCache() {
-	for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-		if (_cachedScripts[i]) {
-			SAFE_DELETE(_cachedScripts[i]);
-		}
+	for (CachedScripts::iterator it = _cachedScripts.begin(); it != _cachedScripts.end(); ++it) {
+		delete it->_value;
 	}
+	_cachedScripts.clear();
+	_cachedScriptsSize = 0;
+
 	return STATUS_OK;
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::trimScriptCache(CScCachedScript *keep) {
+	// drop the least recently used scripts until we fit, but never the one just handed out
+	while (_cachedScriptsSize > MAX_CACHED_SCRIPTS_SIZE && _cachedScripts.size() > 1) {
+		CachedScripts::iterator oldest = _cachedScripts.end();
+		for (CachedScripts::iterator it = _cachedScripts.begin(); it != _cachedScripts.end(); ++it) {
+			if (it->_value != keep && (oldest == _cachedScripts.end() || it->_value->_timestamp < oldest->_value->_timestamp)) {
+				oldest = it;
+			}
+		}
+
+		_cachedScriptsSize -= oldest->_value->_size;
+		delete oldest->_value;
+		_cachedScripts.erase(oldest);
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::resetObject(BaseObject *object) {
 	// terminate all scripts waiting for this object
@@ -599,6 +652,7 @@ void ScEngine::enableProfiling() {
 
 	// destroy old data, if any
 	_scriptTimes.clear();
+	_profilingInstructions = 0;
 
 	_profilingStartTime = BasePlatform::getTime();
 	_isProfiling = true;
@@ -618,27 +672,31 @@ void ScEngine::disableProfiling() {
 
 //////////////////////////////////////////////////////////////////////////
 void ScEngine::dumpStats() {
-	error("DumpStats not ported to ScummVM yet");
-	/*  uint32 totalTime = BasePlatform::getTime() - _profilingStartTime;
+	uint32 totalTime = BasePlatform::getTime() - _profilingStartTime;
 
-	    typedef std::vector <std::pair<uint32, std::string> > TimeVector;
-	    TimeVector times;
+	struct ScriptTime {
+		uint32 time;
+		Common::String filename;
+	};
+	Common::Array<ScriptTime> times;
 
-	    ScriptTimes::iterator it;
-	    for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
-	        times.push_back(std::pair<uint32, std::string> (it->_value, it->_key));
-	    }
-	    std::sort(times.begin(), times.end());
-
-
-	    TimeVector::reverse_iterator tit;
+	for (ScriptTimes::iterator it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
+		ScriptTime entry = { it->_value, it->_key };
+		times.push_back(entry);
+	}
+	Common::sort(times.begin(), times.end(), [](const ScriptTime &a, const ScriptTime &b) {
+		return a.time > b.time;
+	});
 
-	    _game->LOG(0, "***** Script profiling information: *****");
-	    _game->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+	_game->LOG(0, "***** Script profiling information: *****");
+	_game->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+	_game->LOG(0, "  %-40s %u (%u/s)", "Instructions executed", _profilingInstructions,
+	           totalTime ? (uint32)((uint64)_profilingInstructions * 1000 / totalTime) : 0);
 
-	    for (tit = times.rbegin(); tit != times.rend(); ++tit) {
-	        _game->LOG(0, "  %-40s %fs (%f%%)", tit->second.c_str(), (float)tit->first / 1000, (float)tit->first / (float)totalTime * 100);
-	    }*/
+	for (uint32 i = 0; i < times.size(); i++) {
+		_game->LOG(0, "  %-40s %fs (%f%%)", times[i].filename.c_str(), (float)times[i].time / 1000,
+		           totalTime ? (float)times[i].time / (float)totalTime * 100 : 0.0f);
+	}
 }
 
 } // End of namespace Wintermute
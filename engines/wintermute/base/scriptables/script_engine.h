@@ -33,9 +33,12 @@
 #include "engines/wintermute/base/base.h"
 #include "engines/wintermute/platform_osystem.h"
 
+#include "common/hash-str.h"
+
 namespace Wintermute {
 
-#define MAX_CACHED_SCRIPTS 20
+// total bytecode kept by the compiled script cache
+#define MAX_CACHED_SCRIPTS_SIZE (4 * 1024 * 1024)
 class ScScript;
 class ScValue;
 class BaseObject;
@@ -112,9 +115,19 @@ public:
 
 private:
 
-	CScCachedScript *_cachedScripts[MAX_CACHED_SCRIPTS];
+	typedef Common::HashMap<Common::String, CScCachedScript *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> CachedScripts;
+	CachedScripts _cachedScripts;
+	uint32 _cachedScriptsSize;
+	uint32 _cacheClock;
+	void trimScriptCache(CScCachedScript *keep);
 	bool _isProfiling;
 	uint32 _profilingStartTime;
+	uint32 _profilingInstructions;
+
+	// instructions executed by tick() since _statsStartTime, for the "script" debug channel
+	uint32 _statsInstructions;
+	uint32 _statsStartTime;
+	void reportStats(uint32 instructions);
 
 	typedef Common::HashMap<Common::String, uint32> ScriptTimes;
 	ScriptTimes _scriptTimes;
@@ -41,6 +41,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScValue, false)
 
+uint32 ScValue::_propsCounter = 0;
+
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_type = VAL_NULL;
@@ -53,6 +55,7 @@ ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -68,6 +71,7 @@ ScValue::ScValue(BaseGame *inGame, bool val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -83,6 +87,7 @@ ScValue::ScValue(BaseGame *inGame, int32 val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -98,6 +103,7 @@ ScValue::ScValue(BaseGame *inGame, double val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -114,6 +120,7 @@ ScValue::ScValue(BaseGame *inGame, const char *val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	touchProps();
 }
 
 
@@ -198,6 +205,7 @@ bool ScValue::deleteProp(const char *name) {
 	if (_valIter != _valObject.end()) {
 		delete _valIter->_value;
 		_valIter->_value = nullptr;
+		touchProps();
 	}
 
 	return STATUS_OK;
@@ -225,13 +233,14 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 		}
 		if (!newVal) {
 			newVal = new ScValue(_game);
+			_valObject[name] = newVal;
+			touchProps();
 		} else {
 			newVal->cleanup();
 		}
 
 		newVal->copy(val, copyWhole);
 		newVal->_isConstVar = setAsConst;
-		_valObject[name] = newVal;
 
 		if (_type != VAL_NATIVE) {
 			_type = VAL_OBJECT;
@@ -267,6 +276,31 @@ bool ScValue::propExists(const char *name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::findProp(const Common::String &name) {
+	if (_type == VAL_VARIABLE_REF) {
+		return _valRef->findProp(name);
+	}
+
+	// natives and strings may answer with computed properties
+	if (_type == VAL_NATIVE || _type == VAL_STRING) {
+		return propExists(name.c_str()) ? getProp(name.c_str()) : nullptr;
+	}
+
+	_valIter = _valObject.find(name);
+	if (_valIter != _valObject.end()) {
+		return _valIter->_value;
+	}
+	return nullptr;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void ScValue::touchProps() {
+	_propsVersion = ++_propsCounter;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 void ScValue::deleteProps() {
 	_valIter = _valObject.begin();
@@ -275,6 +309,7 @@ void ScValue::deleteProps() {
 		_valIter++;
 	}
 	_valObject.clear();
+	touchProps();
 }
 
 
@@ -814,6 +849,7 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 			_valObject[str] = val;
 			delete[] str;
 		}
+		touchProps();
 	}
 
 	persistMgr->transferPtr(TMEMBER_PTR(_valRef));
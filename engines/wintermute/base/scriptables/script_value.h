@@ -82,6 +82,11 @@ public:
 	bool isObject();
 	bool setProp(const char *name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
 	ScValue *getProp(const char *name);
+	ScValue *findProp(const Common::String &name);
+	// changes whenever a property is added or removed (but not when one is assigned)
+	uint32 getPropsVersion() const {
+		return _propsVersion;
+	}
 	BaseScriptable *_valNative;
 	ScValue *_valRef;
 	bool _valBool;
@@ -103,6 +108,12 @@ public:
 	bool setProperty(const char *propName, double value);
 	bool setProperty(const char *propName, bool value);
 	bool setProperty(const char *propName);
+
+private:
+	void touchProps();
+
+	uint32 _propsVersion;
+	static uint32 _propsCounter;
 };
 
 } // End of namespace Wintermute
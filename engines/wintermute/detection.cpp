@@ -39,6 +39,9 @@ static const DebugChannelDef debugFlagList[] = {
 	{Wintermute::kWintermuteDebugFileAccess, "file-access", "Non-critical problems like missing files"},
 	{Wintermute::kWintermuteDebugAudio, "audio", "audio-playback-related issues"},
 	{Wintermute::kWintermuteDebugGeneral, "general", "various issues not covered by any of the above"},
+	{Wintermute::kWintermuteDebugRender, "render", "Dirty rects and pixels drawn by the 2D renderer"},
+	{Wintermute::kWintermuteDebugScript, "script", "Script instructions executed per second"},
+	{Wintermute::kWintermuteDebug3D, "3d", "Skinning and animation time of 3D models"},
 	DEBUG_CHANNEL_END
 };
 
@@ -46,6 +46,9 @@ enum {
 	kWintermuteDebugFileAccess, // the current limitation is 32 debug channels (1 << 31 is the last one)
 	kWintermuteDebugAudio,
 	kWintermuteDebugGeneral,
+	kWintermuteDebugRender,
+	kWintermuteDebugScript,
+	kWintermuteDebug3D,
 };
 
 class WintermuteEngine : public Engine {
@@ -0,0 +1,88 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "image/batch_decoder.h"
+#include "image/image_decoder.h"
+
+#include "common/debug.h"
+#include "common/stream.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+namespace Image {
+
+BatchDecoder::BatchDecoder() : _next(0) {
+}
+
+BatchDecoder::~BatchDecoder() {
+	clear();
+}
+
+uint BatchDecoder::add(ImageDecoder *decoder, Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeStream) {
+	assert(decoder && stream);
+
+	Entry entry;
+	entry.decoder = decoder;
+	entry.stream = stream;
+	entry.disposeStream = disposeStream;
+	entry.loaded = false;
+	_images.push_back(entry);
+
+	return _images.size() - 1;
+}
+
+bool BatchDecoder::decode(uint32 maxMillis) {
+	const uint32 start = g_system->getMillis();
+	const uint first = _next;
+
+	while (_next < _images.size()) {
+		Entry &entry = _images[_next++];
+
+		entry.loaded = entry.decoder->loadStream(*entry.stream);
+		if (!entry.loaded)
+			warning("BatchDecoder: Failed to decode image %d", _next - 1);
+
+		disposeStream(entry);
+
+		if (maxMillis && g_system->getMillis() - start >= maxMillis)
+			break;
+	}
+
+	debug(5, "BatchDecoder: Decoded %d images in %d ms, %d left", _next - first, g_system->getMillis() - start, _images.size() - _next);
+	return isDone();
+}
+
+void BatchDecoder::clear() {
+	for (uint i = _next; i < _images.size(); i++)
+		disposeStream(_images[i]);
+
+	_images.clear();
+	_next = 0;
+}
+
+void BatchDecoder::disposeStream(Entry &entry) {
+	if (entry.disposeStream == DisposeAfterUse::YES)
+		delete entry.stream;
+
+	entry.stream = nullptr;
+}
+
+} // End of namespace Image
@@ -0,0 +1,117 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IMAGE_BATCH_DECODER_H
+#define IMAGE_BATCH_DECODER_H
+
+#include "common/array.h"
+#include "common/types.h"
+
+namespace Common {
+class SeekableReadStream;
+}
+
+namespace Image {
+
+class ImageDecoder;
+
+/**
+ * @defgroup image_batch Batch image decoding
+ * @ingroup image
+ *
+ * @brief Decoding of a list of images spread over several calls.
+ * @{
+ */
+
+/**
+ * Decodes a list of images, a few at a time.
+ *
+ * Engines loading many images at once (e.g. when entering a scene) can queue
+ * them all and call decode() with a time budget once per frame, so the game
+ * keeps processing events and drawing while the images are being loaded,
+ * instead of stalling until the last one is done.
+ *
+ * The decoders are owned by the caller and must stay alive until the batch
+ * is done or destroyed. Each image is decoded by a single loadStream() call,
+ * so the time budget is only checked between images.
+ */
+class BatchDecoder {
+public:
+	BatchDecoder();
+	~BatchDecoder();
+
+	/**
+	 * Queue an image for decoding.
+	 *
+	 * @param decoder        The decoder used to load the image.
+	 * @param stream         The stream containing the image.
+	 * @param disposeStream  Whether to delete the stream after decoding it.
+	 *
+	 * @return The index of the image in the batch.
+	 */
+	uint add(ImageDecoder *decoder, Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeStream = DisposeAfterUse::YES);
+
+	/**
+	 * Decode queued images.
+	 *
+	 * @param maxMillis  Stop decoding once this many milliseconds have passed,
+	 *                   or decode all the remaining images if 0.
+	 *
+	 * @return true if all the queued images have been decoded.
+	 */
+	bool decode(uint32 maxMillis = 0);
+
+	/** Query whether all the queued images have been decoded. */
+	bool isDone() const { return _next == _images.size(); }
+
+	/** Get the number of queued images. */
+	uint size() const { return _images.size(); }
+
+	/** Get the number of images decoded so far. */
+	uint getDecodedCount() const { return _next; }
+
+	/** Get the decoder of the given image. */
+	ImageDecoder *getDecoder(uint index) const { return _images[index].decoder; }
+
+	/** Query whether the given image has been decoded successfully. */
+	bool isLoaded(uint index) const { return _images[index].loaded; }
+
+	/** Drop all the queued images, deleting the streams not decoded yet as requested. */
+	void clear();
+
+private:
+	struct Entry {
+		ImageDecoder *decoder;
+		Common::SeekableReadStream *stream;
+		DisposeAfterUse::Flag disposeStream;
+		bool loaded;
+	};
+
+	Common::Array<Entry> _images;
+	uint _next;
+
+	void disposeStream(Entry &entry);
+};
+
+/** @} */
+} // End of namespace Image
+
+#endif
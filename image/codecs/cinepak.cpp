@@ -59,15 +59,17 @@ inline uint16 createDitherTableIndex(const byte *clipTable, byte y, int8 u, int8
 
 /**
  * The default codebook converter for 24bpp: RGB output.
+ *
+ * The codebooks are converted to the output pixel format when they are
+ * loaded, so drawing a block only copies pixels.
  */
 struct CodebookConverterRGB {
 	template<typename PixelInt>
 	static inline void decodeBlock1(byte codebookIndex, const CinepakStrip &strip, PixelInt *dst, size_t dstPitch, const byte *clipTable, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook = strip.v1_codebook[codebookIndex];
-		const int8 u = codebook.u, v = codebook.v;
+		const uint32 *colors = strip.v1_rgb + codebookIndex * 4;
 
-		const PixelInt rgb0 = convertYUVToColor(clipTable, format, codebook.y[0], u, v);
-		const PixelInt rgb1 = convertYUVToColor(clipTable, format, codebook.y[1], u, v);
+		const PixelInt rgb0 = colors[0];
+		const PixelInt rgb1 = colors[1];
 
 		dst[0] = dst[1] = rgb0;
 		dst[2] = dst[3] = rgb1;
@@ -77,8 +79,8 @@ struct CodebookConverterRGB {
 		dst[2] = dst[3] = rgb1;
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		const PixelInt rgb2 = convertYUVToColor(clipTable, format, codebook.y[2], u, v);
-		const PixelInt rgb3 = convertYUVToColor(clipTable, format, codebook.y[3], u, v);
+		const PixelInt rgb2 = colors[2];
+		const PixelInt rgb3 = colors[3];
 
 		dst[0] = dst[1] = rgb2;
 		dst[2] = dst[3] = rgb3;
@@ -91,34 +93,34 @@ struct CodebookConverterRGB {
 
 	template<typename PixelInt>
 	static inline void decodeBlock4(const byte (&codebookIndex)[4], const CinepakStrip &strip, PixelInt *dst, size_t dstPitch, const byte *clipTable, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook1 = strip.v4_codebook[codebookIndex[0]];
-		const CinepakCodebook &codebook2 = strip.v4_codebook[codebookIndex[1]];
+		const uint32 *colors1 = strip.v4_rgb + codebookIndex[0] * 4;
+		const uint32 *colors2 = strip.v4_rgb + codebookIndex[1] * 4;
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook1.y[0], codebook1.u, codebook1.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook1.y[1], codebook1.u, codebook1.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook2.y[0], codebook2.u, codebook2.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook2.y[1], codebook2.u, codebook2.v);
+		dst[0] = colors1[0];
+		dst[1] = colors1[1];
+		dst[2] = colors2[0];
+		dst[3] = colors2[1];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook1.y[2], codebook1.u, codebook1.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook1.y[3], codebook1.u, codebook1.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook2.y[2], codebook2.u, codebook2.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook2.y[3], codebook2.u, codebook2.v);
+		dst[0] = colors1[2];
+		dst[1] = colors1[3];
+		dst[2] = colors2[2];
+		dst[3] = colors2[3];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		const CinepakCodebook &codebook3 = strip.v4_codebook[codebookIndex[2]];
-		const CinepakCodebook &codebook4 = strip.v4_codebook[codebookIndex[3]];
+		const uint32 *colors3 = strip.v4_rgb + codebookIndex[2] * 4;
+		const uint32 *colors4 = strip.v4_rgb + codebookIndex[3] * 4;
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook3.y[0], codebook3.u, codebook3.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook3.y[1], codebook3.u, codebook3.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook4.y[0], codebook4.u, codebook4.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook4.y[1], codebook4.u, codebook4.v);
+		dst[0] = colors3[0];
+		dst[1] = colors3[1];
+		dst[2] = colors4[0];
+		dst[3] = colors4[1];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook3.y[2], codebook3.u, codebook3.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook3.y[3], codebook3.u, codebook3.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook4.y[2], codebook4.u, codebook4.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook4.y[3], codebook4.u, codebook4.v);
+		dst[0] = colors3[2];
+		dst[1] = colors3[3];
+		dst[2] = colors4[2];
+		dst[3] = colors4[3];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 	}
 };
@@ -365,6 +367,10 @@ const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream
 			// Copy the dither tables
 			memcpy(_curFrame.strips[i].v1_dither, _curFrame.strips[i - 1].v1_dither, 256 * 4 * 4 * sizeof(uint32));
 			memcpy(_curFrame.strips[i].v4_dither, _curFrame.strips[i - 1].v4_dither, 256 * 4 * 4 * sizeof(uint32));
+
+			// Copy the converted codebooks
+			memcpy(_curFrame.strips[i].v1_rgb, _curFrame.strips[i - 1].v1_rgb, 256 * 4 * sizeof(uint32));
+			memcpy(_curFrame.strips[i].v4_rgb, _curFrame.strips[i - 1].v4_rgb, 256 * 4 * sizeof(uint32));
 		}
 
 		_curFrame.strips[i].id = stream.readUint16BE();
@@ -441,6 +447,8 @@ void CinepakDecoder::initializeCodebook(uint16 strip, byte codebookType) {
 			ditherCodebookQT(strip, codebookType, i);
 		else if (_ditherType == kDitherTypeVFW)
 			ditherCodebookVFW(strip, codebookType, i);
+		else if (_bitsPerPixel != 8)
+			convertCodebookRGB(strip, codebookType, i);
 	}
 }
 
@@ -477,11 +485,14 @@ void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 str
 				codebook[i].v = 0;
 			}
 
-			// Dither the codebook if we're dithering for QuickTime
+			// Dither the codebook if we're dithering for QuickTime,
+			// otherwise convert it to the output pixel format
 			if (_ditherType == kDitherTypeQT)
 				ditherCodebookQT(strip, codebookType, i);
 			else if (_ditherType == kDitherTypeVFW)
 				ditherCodebookVFW(strip, codebookType, i);
+			else if (_bitsPerPixel != 8)
+				convertCodebookRGB(strip, codebookType, i);
 		}
 	}
 }
@@ -544,6 +555,17 @@ void CinepakDecoder::ditherCodebookQT(uint16 strip, byte codebookType, uint16 co
 	}
 }
 
+void CinepakDecoder::convertCodebookRGB(uint16 strip, byte codebookType, uint16 codebookIndex) {
+	const CinepakCodebook &codebook = (codebookType == 1) ? _curFrame.strips[strip].v1_codebook[codebookIndex] : _curFrame.strips[strip].v4_codebook[codebookIndex];
+	uint32 *output = ((codebookType == 1) ? _curFrame.strips[strip].v1_rgb : _curFrame.strips[strip].v4_rgb) + codebookIndex * 4;
+
+	// The frame surface is only created after the first codebooks are initialized
+	const Graphics::PixelFormat &format = _curFrame.surface ? _curFrame.surface->format : _pixelFormat;
+
+	for (int i = 0; i < 4; i++)
+		output[i] = convertYUVToColor(_clipTable, format, codebook.y[i], codebook.u, codebook.v);
+}
+
 static inline byte getRGBLookupEntry(const byte *colorMap, uint16 index) {
 	return colorMap[CLIP<int>(index, 0, 1023)];
 }
@@ -35,6 +35,7 @@ RPZADecoder::RPZADecoder(uint16 width, uint16 height) : Codec(), _ditherPalette(
 	_format = Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0);
 	_dirtyPalette = false;
 	_colorMap = 0;
+	_rgbMap = 0;
 	_width = width;
 	_height = height;
 	_blockWidth = (width + 3) / 4;
@@ -49,6 +50,7 @@ RPZADecoder::~RPZADecoder() {
 	}
 
 	delete[] _colorMap;
+	delete[] _rgbMap;
 }
 
 #define ADVANCE_BLOCK() \
@@ -203,6 +205,53 @@ struct BlockDecoderDither {
 	}
 };
 
+/**
+ * Block decoder for 16bpp and 32bpp output in a format other than RGB555.
+ * The color map is a lookup table from RGB555 to the output format.
+ */
+template<typename PixelInt>
+struct BlockDecoderRGB {
+	static inline void drawFillBlock(PixelInt *blockPtr, uint16 pitch, uint16 color, const byte *colorMap) {
+		const PixelInt pixel = ((const PixelInt *)colorMap)[color & 0x7FFF];
+
+		for (int y = 0; y < 4; y++) {
+			blockPtr[0] = pixel;
+			blockPtr[1] = pixel;
+			blockPtr[2] = pixel;
+			blockPtr[3] = pixel;
+			blockPtr += pitch;
+		}
+	}
+
+	static inline void drawRawBlock(PixelInt *blockPtr, uint16 pitch, const uint16 (&colors)[16], const byte *colorMap) {
+		const PixelInt *lookup = (const PixelInt *)colorMap;
+
+		for (int y = 0; y < 4; y++) {
+			blockPtr[0] = lookup[colors[y * 4 + 0] & 0x7FFF];
+			blockPtr[1] = lookup[colors[y * 4 + 1] & 0x7FFF];
+			blockPtr[2] = lookup[colors[y * 4 + 2] & 0x7FFF];
+			blockPtr[3] = lookup[colors[y * 4 + 3] & 0x7FFF];
+			blockPtr += pitch;
+		}
+	}
+
+	static inline void drawBlendBlock(PixelInt *blockPtr, uint16 pitch, const uint16 (&colors)[4], const byte (&indexes)[4], const byte *colorMap) {
+		const PixelInt *lookup = (const PixelInt *)colorMap;
+		const PixelInt pixels[4] = {
+			lookup[colors[0] & 0x7FFF], lookup[colors[1] & 0x7FFF],
+			lookup[colors[2] & 0x7FFF], lookup[colors[3] & 0x7FFF]
+		};
+
+		for (int y = 0; y < 4; y++) {
+			blockPtr[0] = pixels[(indexes[y] >> 6) & 0x03];
+			blockPtr[1] = pixels[(indexes[y] >> 4) & 0x03];
+			blockPtr[2] = pixels[(indexes[y] >> 2) & 0x03];
+			blockPtr[3] = pixels[(indexes[y] >> 0) & 0x03];
+			blockPtr += pitch;
+		}
+	}
+};
+
 template<typename PixelInt, typename BlockDecoder>
 static inline void decodeFrameTmpl(Common::SeekableReadStream &stream, PixelInt *ptr, uint16 pitch, uint16 blockWidth, uint16 blockHeight, const byte *colorMap) {
 	uint16 colorA = 0, colorB = 0;
@@ -339,12 +388,51 @@ const Graphics::Surface *RPZADecoder::decodeFrame(Common::SeekableReadStream &st
 
 	if (_colorMap)
 		decodeFrameTmpl<byte, BlockDecoderDither>(stream, (byte *)_surface->getPixels(), _surface->pitch, _blockWidth, _blockHeight, _colorMap);
+	else if (_rgbMap && _format.bytesPerPixel == 2)
+		decodeFrameTmpl<uint16, BlockDecoderRGB<uint16> >(stream, (uint16 *)_surface->getPixels(), _surface->pitch / 2, _blockWidth, _blockHeight, _rgbMap);
+	else if (_rgbMap)
+		decodeFrameTmpl<uint32, BlockDecoderRGB<uint32> >(stream, (uint32 *)_surface->getPixels(), _surface->pitch / 4, _blockWidth, _blockHeight, _rgbMap);
 	else
 		decodeFrameTmpl<uint16, BlockDecoderRaw>(stream, (uint16 *)_surface->getPixels(), _surface->pitch / 2, _blockWidth, _blockHeight, _colorMap);
 
 	return _surface;
 }
 
+bool RPZADecoder::setOutputPixelFormat(const Graphics::PixelFormat &format) {
+	// The frame is decoded on top of the previous one, so the format
+	// can't be changed after the first frame
+	if (_surface || _colorMap)
+		return format == _format;
+
+	if (format.bytesPerPixel != 2 && format.bytesPerPixel != 4)
+		return false;
+
+	_format = format;
+
+	delete[] _rgbMap;
+	_rgbMap = 0;
+
+	const Graphics::PixelFormat rgb555(2, 5, 5, 5, 0, 10, 5, 0, 0);
+	if (format == rgb555)
+		return true;
+
+	// Build a lookup table from RGB555 to the output format
+	_rgbMap = new byte[0x8000 * format.bytesPerPixel];
+
+	for (uint32 i = 0; i < 0x8000; i++) {
+		byte r, g, b;
+		rgb555.colorToRGB(i, r, g, b);
+		uint32 color = format.RGBToColor(r, g, b);
+
+		if (format.bytesPerPixel == 2)
+			((uint16 *)_rgbMap)[i] = color;
+		else
+			((uint32 *)_rgbMap)[i] = color;
+	}
+
+	return true;
+}
+
 bool RPZADecoder::canDither(DitherType type) const {
 	return type == kDitherTypeQT;
 }
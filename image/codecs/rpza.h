@@ -40,6 +40,7 @@ public:
 
 	const Graphics::Surface *decodeFrame(Common::SeekableReadStream &stream) override;
 	Graphics::PixelFormat getPixelFormat() const override { return _format; }
+	bool setOutputPixelFormat(const Graphics::PixelFormat &format) override;
 
 	bool containsPalette() const override { return _ditherPalette != 0; }
 	const byte *getPalette() override { _dirtyPalette = false; return _ditherPalette.data(); }
@@ -53,6 +54,7 @@ private:
 	Graphics::Palette _ditherPalette;
 	bool _dirtyPalette;
 	byte *_colorMap;
+	byte *_rgbMap;
 	uint16 _width, _height;
 	uint16 _blockWidth, _blockHeight;
 };
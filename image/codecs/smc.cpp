@@ -44,6 +44,9 @@ namespace Image {
 	} \
 }
 
+// Check that the 4x4 block starting at the given pixel lies entirely within the frame
+#define BLOCK_IN_BOUNDS(ptr) ((ptr) + _surface->w * 3 + 4 <= pixelSize)
+
 SMCDecoder::SMCDecoder(uint16 width, uint16 height) {
 	_surface = new Graphics::Surface();
 	_surface->create(width, height, Graphics::PixelFormat::createFormatCLUT8());
@@ -132,14 +135,22 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 			while (numBlocks--) {
 				blockPtr = rowPtr + pixelPtr;
 				prevBlockPtr = prevBlockPtr1;
-				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++) {
-						if (blockPtr < pixelSize)
-							pixels[blockPtr] = pixels[prevBlockPtr];
-						blockPtr++, prevBlockPtr++;
+				if (BLOCK_IN_BOUNDS(blockPtr)) {
+					for (byte y = 0; y < 4; y++) {
+						memmove(pixels + blockPtr, pixels + prevBlockPtr, 4);
+						blockPtr += _surface->w;
+						prevBlockPtr += _surface->w;
+					}
+				} else {
+					for (byte y = 0; y < 4; y++) {
+						for (byte x = 0; x < 4; x++) {
+							if (blockPtr < pixelSize)
+								pixels[blockPtr] = pixels[prevBlockPtr];
+							blockPtr++, prevBlockPtr++;
+						}
+						blockPtr += rowInc;
+						prevBlockPtr += rowInc;
 					}
-					blockPtr += rowInc;
-					prevBlockPtr += rowInc;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -181,15 +192,23 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 
 				prevBlockFlag = !prevBlockFlag;
 
-				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++) {
-						if (blockPtr < pixelSize)
-							pixels[blockPtr] = pixels[prevBlockPtr];
-						blockPtr++, prevBlockPtr++;
+				if (BLOCK_IN_BOUNDS(blockPtr)) {
+					for (byte y = 0; y < 4; y++) {
+						memmove(pixels + blockPtr, pixels + prevBlockPtr, 4);
+						blockPtr += _surface->w;
+						prevBlockPtr += _surface->w;
+					}
+				} else {
+					for (byte y = 0; y < 4; y++) {
+						for (byte x = 0; x < 4; x++) {
+							if (blockPtr < pixelSize)
+								pixels[blockPtr] = pixels[prevBlockPtr];
+							blockPtr++, prevBlockPtr++;
+						}
+
+						blockPtr += rowInc;
+						prevBlockPtr += rowInc;
 					}
-
-					blockPtr += rowInc;
-					prevBlockPtr += rowInc;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -203,14 +222,21 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 
 			while (numBlocks--) {
 				blockPtr = rowPtr + pixelPtr;
-				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++) {
-						if (blockPtr < pixelSize)
-							pixels[blockPtr] = pixel;
-						blockPtr++;
+				if (BLOCK_IN_BOUNDS(blockPtr)) {
+					for (byte y = 0; y < 4; y++) {
+						memset(pixels + blockPtr, pixel, 4);
+						blockPtr += _surface->w;
+					}
+				} else {
+					for (byte y = 0; y < 4; y++) {
+						for (byte x = 0; x < 4; x++) {
+							if (blockPtr < pixelSize)
+								pixels[blockPtr] = pixel;
+							blockPtr++;
+						}
+
+						blockPtr += rowInc;
 					}
-
-					blockPtr += rowInc;
 				}
 				ADVANCE_BLOCK();
 			}
@@ -388,15 +414,22 @@ const Graphics::Surface *SMCDecoder::decodeFrame(Common::SeekableReadStream &str
 
 			while (numBlocks--) {
 				blockPtr = rowPtr + pixelPtr;
-				for (byte y = 0; y < 4; y++) {
-					for (byte x = 0; x < 4; x++) {
-						byte b = stream.readByte();
-						if (blockPtr < pixelSize)
-							pixels[blockPtr] = b;
-						blockPtr++;
+				if (BLOCK_IN_BOUNDS(blockPtr)) {
+					for (byte y = 0; y < 4; y++) {
+						stream.read(pixels + blockPtr, 4);
+						blockPtr += _surface->w;
+					}
+				} else {
+					for (byte y = 0; y < 4; y++) {
+						for (byte x = 0; x < 4; x++) {
+							byte b = stream.readByte();
+							if (blockPtr < pixelSize)
+								pixels[blockPtr] = b;
+							blockPtr++;
+						}
+
+						blockPtr += rowInc;
 					}
-
-					blockPtr += rowInc;
 				}
 				ADVANCE_BLOCK();
 			}
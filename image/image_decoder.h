@@ -119,6 +119,30 @@ public:
 	 */
 	virtual bool hasMask() const { return getMask() != 0; }
 };
+
+/**
+ * Receiver for the rows of an image while it is being decoded.
+ *
+ * Decoders supporting this can report rows as soon as they are final, which
+ * lets callers upload or blit the top of a large image while the rest of it
+ * is still being decoded.
+ */
+class ImageRowListener {
+public:
+	virtual ~ImageRowListener() {}
+
+	/**
+	 * Called when rows of the image have been decoded.
+	 *
+	 * The surface is the decoder's output surface, in its final pixel format.
+	 * Rows outside of the given range may not have been decoded yet.
+	 *
+	 * @param surface   The surface being decoded.
+	 * @param firstRow  The first decoded row.
+	 * @param numRows   The number of decoded rows.
+	 */
+	virtual void onImageRows(const Graphics::Surface &surface, int firstRow, int numRows) = 0;
+};
 /** @} */
 } // End of namespace Image
 
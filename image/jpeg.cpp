@@ -51,7 +51,8 @@ JPEGDecoder::JPEGDecoder() :
 		_palette(0),
 		_colorSpace(kColorSpaceRGB),
 		_accuracy(CodecAccuracy::Default),
-		_requestedPixelFormat(getByteOrderRgbPixelFormat()) {
+		_requestedPixelFormat(getByteOrderRgbPixelFormat()),
+		_rowListener(nullptr) {
 }
 
 JPEGDecoder::~JPEGDecoder() {
@@ -361,13 +362,20 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	assert(_surface.pitch >= (int)pitch);
 	JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, pitch, 1);
 
+	// Scanlines can only be reported as they come if they are in their final format
+	const bool needsConversion = (_colorSpace == kColorSpaceRGB && _surface.format != _requestedPixelFormat);
+
 	// Go through the image data scanline by scanline
 	while (cinfo.output_scanline < cinfo.output_height) {
-		byte *dst = (byte *)_surface.getBasePtr(0, cinfo.output_scanline);
+		const int row = cinfo.output_scanline;
+		byte *dst = (byte *)_surface.getBasePtr(0, row);
 
 		jpeg_read_scanlines(&cinfo, buffer, 1);
 
 		memcpy(dst, buffer[0], pitch);
+
+		if (_rowListener && !needsConversion)
+			_rowListener->onImageRows(_surface, row, 1);
 	}
 
 	// We are done with decompressing, thus free all the data
@@ -376,6 +384,9 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 
 	if (_colorSpace == kColorSpaceRGB && _surface.format != _requestedPixelFormat) {
 		_surface.convertToInPlace(_requestedPixelFormat); // Slow path
+
+		if (_rowListener)
+			_rowListener->onImageRows(_surface, 0, _surface.h);
 	}
 
 	return true;
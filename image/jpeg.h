@@ -104,6 +104,13 @@ public:
 	 */
 	void setOutputColorSpace(ColorSpace outSpace) { _colorSpace = outSpace; }
 
+	/**
+	 * Set a listener which gets the scanlines of the image while it is being
+	 * decoded. When the requested pixel format needs a conversion after
+	 * decoding, the whole image is reported once it is converted.
+	 */
+	void setRowListener(ImageRowListener *listener) { _rowListener = listener; }
+
 private:
 	// TODO: Avoid inheriting from multiple superclasses that have identical member functions.
 	using Codec::getPalette;
@@ -112,6 +119,7 @@ private:
 	ColorSpace _colorSpace;
 	Graphics::PixelFormat _requestedPixelFormat;
 	CodecAccuracy _accuracy;
+	ImageRowListener *_rowListener;
 
 	Graphics::PixelFormat getByteOrderRgbPixelFormat() const;
 };
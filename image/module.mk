@@ -2,6 +2,7 @@ MODULE := image
 
 MODULE_OBJS := \
 	ani.o \
+	batch_decoder.o \
 	bmp.o \
 	cel_3do.o \
 	cicn.o \
@@ -45,7 +45,8 @@ PNGDecoder::PNGDecoder() :
 		_skipSignature(false),
 		_keepTransparencyPaletted(false),
 		_hasTransparentColor(false),
-		_transparentColor(0) {
+		_transparentColor(0),
+		_rowListener(nullptr) {
 }
 
 PNGDecoder::~PNGDecoder() {
@@ -252,6 +253,9 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 
 			for (int xp = 0; xp < width; ++xp)
 				destRowP[xp] = rgbaPalette[rowPtr[xp]];
+
+			if (_rowListener)
+				_rowListener->onImageRows(*_outputSurface, yp, 1);
 		}
 
 		delete[] rowPtr;
@@ -259,6 +263,9 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 		// PNGs without interlacing can simply be read row by row.
 		for (int i = 0; i < height; i++) {
 			png_read_row(pngPtr, (png_bytep)_outputSurface->getBasePtr(0, i), NULL);
+
+			if (_rowListener)
+				_rowListener->onImageRows(*_outputSurface, i, 1);
 		}
 	} else {
 		// PNGs with interlacing require us to allocate an auxiliary
@@ -279,6 +286,10 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 
 		// Free row pointer buffer
 		delete[] rowPtr;
+
+		// Rows of interlaced images are only final after the last pass
+		if (_rowListener)
+			_rowListener->onImageRows(*_outputSurface, 0, height);
 	}
 
 	// Read additional data at the end.
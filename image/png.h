@@ -67,6 +67,12 @@ public:
 	uint32 getTransparentColor() const override { return _transparentColor; }
 	void setSkipSignature(bool skip) { _skipSignature = skip; }
 	void setKeepTransparencyPaletted(bool keep) { _keepTransparencyPaletted = keep; }
+
+	/**
+	 * Set a listener which gets the rows of the image while it is being decoded.
+	 * Interlaced images are only reported once they are fully decoded.
+	 */
+	void setRowListener(ImageRowListener *listener) { _rowListener = listener; }
 private:
 	Graphics::PixelFormat getByteOrderRgbaPixelFormat(bool isAlpha) const;
 
@@ -80,6 +86,8 @@ private:
 	bool _hasTransparentColor;
 	uint32 _transparentColor;
 
+	ImageRowListener *_rowListener;
+
 	Graphics::Surface *_outputSurface;
 };
 
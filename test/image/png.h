@@ -0,0 +1,106 @@
+#include <cxxtest/TestSuite.h>
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/memstream.h"
+#include "graphics/surface.h"
+#include "image/batch_decoder.h"
+#include "image/png.h"
+
+#include "../system/null_osystem.h"
+
+class PNGRowCounter : public Image::ImageRowListener {
+public:
+	PNGRowCounter() : rows(0), inOrder(true) {}
+
+	void onImageRows(const Graphics::Surface &surface, int firstRow, int numRows) override {
+		if (firstRow != rows)
+			inOrder = false;
+		rows += numRows;
+	}
+
+	int rows;
+	bool inOrder;
+};
+
+class PNGDecoderTestSuite : public CxxTest::TestSuite {
+public:
+	void setUp() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+#endif
+	}
+
+	void tearDown() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::uninstall_null_g_system();
+#endif
+	}
+
+	void test_row_listener() {
+#ifdef USE_PNG
+		Common::MemoryWriteStreamDynamic png(DisposeAfterUse::YES);
+		writeTestImage(png, 16, 8);
+
+		PNGRowCounter counter;
+		Image::PNGDecoder decoder;
+		decoder.setRowListener(&counter);
+
+		Common::MemoryReadStream stream(png.getData(), png.size());
+		TS_ASSERT(decoder.loadStream(stream));
+		TS_ASSERT_EQUALS(counter.rows, 8);
+		TS_ASSERT(counter.inOrder);
+#endif
+	}
+
+	void test_batch_decoding() {
+#if defined(USE_PNG) && NULL_OSYSTEM_IS_AVAILABLE
+		const int count = 4;
+		Common::MemoryWriteStreamDynamic png[count] = {
+			Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES),
+			Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES),
+			Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES),
+			Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES)
+		};
+		Image::PNGDecoder decoders[count];
+
+		Image::BatchDecoder batch;
+		for (int i = 0; i < count; i++) {
+			writeTestImage(png[i], 4 + i, 4);
+			batch.add(&decoders[i], new Common::MemoryReadStream(png[i].getData(), png[i].size()));
+		}
+
+		// A corrupted image must not stop the rest of the batch
+		static const byte garbage[] = { 0x89, 'P', 'N', 'X' };
+		Image::PNGDecoder broken;
+		batch.add(&broken, new Common::MemoryReadStream(garbage, sizeof(garbage)));
+
+		TS_ASSERT_EQUALS(batch.size(), (uint)count + 1);
+		TS_ASSERT(!batch.isDone());
+		TS_ASSERT(batch.decode());
+		TS_ASSERT_EQUALS(batch.getDecodedCount(), (uint)count + 1);
+
+		for (int i = 0; i < count; i++) {
+			TS_ASSERT(batch.isLoaded(i));
+			TS_ASSERT_EQUALS(decoders[i].getSurface()->w, 4 + i);
+		}
+		TS_ASSERT(!batch.isLoaded(count));
+#endif
+	}
+
+private:
+	void writeTestImage(Common::WriteStream &out, int width, int height) {
+#ifdef USE_PNG
+		Graphics::Surface surface;
+		surface.create(width, height, Graphics::PixelFormat::createFormatRGBA32());
+		for (int y = 0; y < height; y++)
+			for (int x = 0; x < width; x++)
+				surface.setPixel(x, y, surface.format.ARGBToColor(255, x * 16, y * 16, 0));
+
+		Image::writePNG(out, surface);
+		surface.free();
+#endif
+	}
+};
@@ -0,0 +1,194 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+#include "graphics/surface.h"
+#include "image/codecs/cinepak.h"
+#include "image/codecs/rpza.h"
+#include "image/codecs/smc.h"
+
+#include "../system/null_osystem.h"
+
+#if NULL_OSYSTEM_IS_AVAILABLE
+#define QTCODECS_BENCHMARK_TIME 1
+#else
+#define QTCODECS_BENCHMARK_TIME 0
+#endif
+
+/**
+ * An 8x8 RPZA frame with one fill block, one four color block,
+ * one sixteen color block and one skipped block.
+ */
+static const byte rpzaFrame[] = {
+	0xe1, 0x00, 0x00, 0x32,
+	// Fill
+	0xa0, 0x7c, 0x00,
+	// Four colors
+	0xc0, 0x03, 0xe0, 0x00, 0x1f, 0x1b, 0xe4, 0x1b, 0xe4,
+	// Sixteen colors
+	0x12, 0x34, 0x00, 0x00, 0x04, 0x21, 0x08, 0x42, 0x0c, 0x63,
+	0x10, 0x84, 0x14, 0xa5, 0x18, 0xc6, 0x1c, 0xe7, 0x21, 0x08,
+	0x25, 0x29, 0x29, 0x4a, 0x2d, 0x6b, 0x31, 0x8c, 0x35, 0xad,
+	0x39, 0xce,
+	// Skip
+	0x80
+};
+
+/**
+ * An 8x8 SMC frame with a one color block, a sixteen color block,
+ * a repeat of that block and a skipped block.
+ */
+static const byte smcFrame[] = {
+	0x00, 0x00, 0x00, 0x19,
+	// One color
+	0x60, 0x05,
+	// Sixteen colors
+	0xe0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	// Repeat last block
+	0x20,
+	// Skip
+	0x00
+};
+
+/**
+ * A 4x4 Cinepak frame with one strip holding a single V1 codebook entry
+ * and one V1 coded block using it.
+ */
+static const byte cinepakFrame[] = {
+	0x00, 0x00, 0x00, 0x25, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01,
+	// Strip header
+	0x10, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04,
+	// V1 codebook: y = 40 80 c0 ff, u = 16, v = -32
+	0x22, 0x00, 0x00, 0x0a, 0x40, 0x80, 0xc0, 0xff, 0x10, 0xe0,
+	// V1 vectors
+	0x32, 0x00, 0x00, 0x05, 0x00
+};
+
+class QuickTimeCodecTestSuite : public CxxTest::TestSuite {
+public:
+	void setUp() {
+#if QTCODECS_BENCHMARK_TIME
+		Common::install_null_g_system();
+#endif
+	}
+
+	void tearDown() {
+#if QTCODECS_BENCHMARK_TIME
+		Common::uninstall_null_g_system();
+#endif
+	}
+
+	void test_rpza_direct_output() {
+		const Graphics::PixelFormat formats[] = {
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24),
+			Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0)
+		};
+
+		Image::RPZADecoder reference(8, 8);
+		Common::MemoryReadStream referenceStream(rpzaFrame, sizeof(rpzaFrame));
+		const Graphics::Surface *expected = reference.decodeFrame(referenceStream);
+
+		for (int i = 0; i < ARRAYSIZE(formats); i++) {
+			Image::RPZADecoder decoder(8, 8);
+			TS_ASSERT(decoder.setOutputPixelFormat(formats[i]));
+
+			Common::MemoryReadStream stream(rpzaFrame, sizeof(rpzaFrame));
+			const Graphics::Surface *surface = decoder.decodeFrame(stream);
+			TS_ASSERT_EQUALS(surface->format, formats[i]);
+
+			for (int y = 0; y < 8; y++) {
+				for (int x = 0; x < 8; x++) {
+					byte r1, g1, b1, r2, g2, b2;
+					expected->format.colorToRGB(expected->getPixel(x, y), r1, g1, b1);
+					formats[i].colorToRGB(formats[i].RGBToColor(r1, g1, b1), r1, g1, b1);
+					surface->format.colorToRGB(surface->getPixel(x, y), r2, g2, b2);
+
+					TS_ASSERT_EQUALS(r1, r2);
+					TS_ASSERT_EQUALS(g1, g2);
+					TS_ASSERT_EQUALS(b1, b2);
+				}
+			}
+		}
+
+		// The format can't change once decoding has started
+		TS_ASSERT(!reference.setOutputPixelFormat(formats[0]));
+	}
+
+	void test_cinepak_rgb_depths() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		// Every depth other than 8bpp goes through the RGB codebooks
+		const int depths[] = { 24, 32 };
+		const byte lumas[] = { 0x40, 0x80, 0xc0, 0xff };
+		const int u = 16, v = -32;
+
+		for (int i = 0; i < ARRAYSIZE(depths); i++) {
+			Image::CinepakDecoder decoder(depths[i]);
+			TS_ASSERT(decoder.setOutputPixelFormat(Graphics::PixelFormat::createFormatRGBA32()));
+
+			Common::MemoryReadStream stream(cinepakFrame, sizeof(cinepakFrame));
+			const Graphics::Surface *surface = decoder.decodeFrame(stream);
+
+			for (int y = 0; y < 4; y++) {
+				for (int x = 0; x < 4; x++) {
+					const byte luma = lumas[(y / 2) * 2 + x / 2];
+					byte r, g, b;
+					surface->format.colorToRGB(surface->getPixel(x, y), r, g, b);
+
+					TS_ASSERT_EQUALS(r, (byte)CLIP<int>(luma + v * 2, 0, 255));
+					TS_ASSERT_EQUALS(g, (byte)CLIP<int>(luma - (u >> 1) - v, 0, 255));
+					TS_ASSERT_EQUALS(b, (byte)CLIP<int>(luma + u * 2, 0, 255));
+				}
+			}
+		}
+#endif
+	}
+
+	void test_smc_blocks() {
+		Image::SMCDecoder decoder(8, 8);
+
+		Common::MemoryReadStream stream(smcFrame, sizeof(smcFrame));
+		const Graphics::Surface *surface = decoder.decodeFrame(stream);
+
+		for (int y = 0; y < 4; y++) {
+			for (int x = 0; x < 4; x++) {
+				TS_ASSERT_EQUALS(surface->getPixel(x, y), 5U);
+				TS_ASSERT_EQUALS(surface->getPixel(x + 4, y), (uint32)(y * 4 + x));
+				TS_ASSERT_EQUALS(surface->getPixel(x, y + 4), (uint32)(y * 4 + x));
+				TS_ASSERT_EQUALS(surface->getPixel(x + 4, y + 4), 0U);
+			}
+		}
+	}
+
+	void test_codec_speed() {
+#if QTCODECS_BENCHMARK_TIME
+#ifdef SLOW_TESTS
+		const int iters = 100000;
+#else
+		const int iters = 1;
+#endif
+		const Graphics::PixelFormat format(4, 8, 8, 8, 8, 16, 8, 0, 24);
+
+		Image::RPZADecoder rpza(8, 8);
+		rpza.setOutputPixelFormat(format);
+		uint32 start = g_system->getMillis();
+		for (int i = 0; i < iters; i++) {
+			Common::MemoryReadStream stream(rpzaFrame, sizeof(rpzaFrame));
+			rpza.decodeFrame(stream);
+		}
+		uint32 rpzaTime = g_system->getMillis() - start;
+
+		Image::SMCDecoder smc(8, 8);
+		start = g_system->getMillis();
+		for (int i = 0; i < iters; i++) {
+			Common::MemoryReadStream stream(smcFrame, sizeof(smcFrame));
+			smc.decodeFrame(stream);
+		}
+		uint32 smcTime = g_system->getMillis() - start;
+
+		debug("RPZA decode time for %d frames (in milliseconds): %d\n", iters, rpzaTime);
+		debug("SMC decode time for %d frames (in milliseconds): %d\n", iters, smcTime);
+#endif
+	}
+};
@@ -532,6 +532,7 @@ void AVIDecoder::close() {
 	_movieListEnd = 0;
 
 	_indexEntries.clear();
+	_seekTable = SeekTable();
 	memset(&_header, 0, sizeof(_header));
 
 	_videoTracks.clear();
@@ -702,7 +703,6 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 
 	// Get our video
 	AVIVideoTrack *videoTrack = (AVIVideoTrack *)_videoTracks[0].track;
-	uint32 videoIndex = _videoTracks[0].index;
 
 	if (time == getDuration()) {
 		videoTrack->setCurFrame(videoTrack->getFrameCount() - 1);
@@ -722,58 +722,33 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 		frame = videoTrack->getFrameAtTime(time);
 	}
 
-	// Reset any palette, if necessary
-	videoTrack->useInitialPalette();
-
-	int lastKeyFrame = -1;
-	int frameIndex = -1;
-	uint curFrame = 0;
-
-	// Go through and figure out where we should be
-	// If there's a palette, we need to find the palette too
-	for (uint32 i = 0; i < _indexEntries.size(); i++) {
-		const OldIndex &index = _indexEntries[i];
+	if (_seekTable.frames.empty())
+		buildSeekTable();
 
-		// We don't care about RECs
-		if (index.id == ID_REC)
-			continue;
+	if (frame >= _seekTable.frames.size()) // This shouldn't happen.
+		return false;
 
-		// We're only looking at entries for this track
-		if (getStreamIndex(index.id) != videoIndex)
-			continue;
+	uint32 frameIndex = _seekTable.frames[frame];
+	uint32 keyFrame = _seekTable.keyFrames[frame];
 
-		uint16 streamType = getStreamType(index.id);
+	// Reset any palette, if necessary
+	videoTrack->useInitialPalette();
 
-		if (streamType == kStreamTypePaletteChange) {
-			// We need to handle any palette change we see since there's no
-			// flag to tell if this is a "key" palette.
-			// Decode the palette
-			_fileStream->seek(_indexEntries[i].offset + 8);
-			Common::SeekableReadStream *chunk = 0;
+	// We need to handle any palette change before the frame since there's no
+	// flag to tell if this is a "key" palette.
+	for (uint32 i = 0; i < _seekTable.palettes.size() && _seekTable.palettes[i] < frameIndex; i++) {
+		const OldIndex &index = _indexEntries[_seekTable.palettes[i]];
 
-			if (_indexEntries[i].size != 0)
-				chunk = _fileStream->readStream(_indexEntries[i].size);
+		// Decode the palette
+		_fileStream->seek(index.offset + 8);
+		Common::SeekableReadStream *chunk = 0;
 
-			videoTrack->loadPaletteFromChunk(chunk);
-		} else {
-			// Check to see if this is a keyframe
-			// The first frame has to be a keyframe
-			if ((_indexEntries[i].flags & AVIIF_INDEX) || curFrame == 0)
-				lastKeyFrame = i;
-
-			// Did we find the target frame?
-			if (frame == curFrame) {
-				frameIndex = i;
-				break;
-			}
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
-			curFrame++;
-		}
+		videoTrack->loadPaletteFromChunk(chunk);
 	}
 
-	if (frameIndex < 0) // This shouldn't happen.
-		return false;
-
 	// Update all the audio tracks
 	for (uint32 i = 0; i < _audioTracks.size(); i++) {
 		AVIAudioTrack *audioTrack = (AVIAudioTrack *)_audioTracks[i].track;
@@ -784,25 +759,15 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 		// Set the chunk index for the track
 		audioTrack->setCurChunk(frame);
 
-		uint32 chunksFound = 0;
-		for (uint32 j = 0; j < _indexEntries.size(); j++) {
+		const Common::Array<uint32> &audioChunks = _seekTable.audioChunks[i];
+		if (frame < audioChunks.size()) {
+			uint32 j = audioChunks[frame];
 			const OldIndex &index = _indexEntries[j];
 
-			// Continue ignoring RECs
-			if (index.id == ID_REC)
-				continue;
-
-			if (getStreamIndex(index.id) == _audioTracks[i].index) {
-				if (chunksFound == frame) {
-					_fileStream->seek(index.offset + 8);
-					Common::SeekableReadStream *audioChunk = _fileStream->readStream(index.size);
-					audioTrack->queueSound(audioChunk);
-					_audioTracks[i].chunkSearchOffset = (j == _indexEntries.size() - 1) ? _movieListEnd : _indexEntries[j + 1].offset;
-					break;
-				}
-
-				chunksFound++;
-			}
+			_fileStream->seek(index.offset + 8);
+			Common::SeekableReadStream *audioChunk = _fileStream->readStream(index.size);
+			audioTrack->queueSound(audioChunk);
+			_audioTracks[i].chunkSearchOffset = (j == _indexEntries.size() - 1) ? _movieListEnd : _indexEntries[j + 1].offset;
 		}
 
 		// Skip any audio to bring us to the right time
@@ -810,25 +775,14 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 	}
 
 	// Decode from keyFrame to curFrame - 1
-	for (int i = lastKeyFrame; i < frameIndex; i++) {
-		if (_indexEntries[i].id == ID_REC)
-			continue;
+	for (uint32 i = keyFrame; i < frame; i++) {
+		const OldIndex &index = _indexEntries[_seekTable.frames[i]];
 
-		if (getStreamIndex(_indexEntries[i].id) != videoIndex)
-			continue;
-
-		uint16 streamType = getStreamType(_indexEntries[i].id);
-
-		// Ignore palettes, they were already handled
-		if (streamType == kStreamTypePaletteChange)
-			continue;
-
-		// Frame, hopefully
-		_fileStream->seek(_indexEntries[i].offset + 8);
+		_fileStream->seek(index.offset + 8);
 		Common::SeekableReadStream *chunk = 0;
 
-		if (_indexEntries[i].size != 0)
-			chunk = _fileStream->readStream(_indexEntries[i].size);
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
 		videoTrack->decodeFrame(chunk);
 	}
@@ -883,6 +837,47 @@ void AVIDecoder::seekTransparencyFrame(int frame) {
 	transTrack->setCurFrame(frame - 1);
 }
 
+void AVIDecoder::buildSeekTable() {
+	uint32 videoIndex = _videoTracks[0].index;
+	uint32 keyFrame = 0;
+
+	_seekTable.audioChunks.resize(_audioTracks.size());
+
+	for (uint32 i = 0; i < _indexEntries.size(); i++) {
+		const OldIndex &index = _indexEntries[i];
+
+		// We don't care about RECs
+		if (index.id == ID_REC)
+			continue;
+
+		uint32 streamIndex = getStreamIndex(index.id);
+
+		if (streamIndex == videoIndex) {
+			if (getStreamType(index.id) == kStreamTypePaletteChange) {
+				_seekTable.palettes.push_back(i);
+			} else {
+				// Check to see if this is a keyframe
+				// The first frame has to be a keyframe
+				uint32 frame = _seekTable.frames.size();
+				if ((index.flags & AVIIF_INDEX) || frame == 0)
+					keyFrame = frame;
+
+				_seekTable.frames.push_back(i);
+				_seekTable.keyFrames.push_back(keyFrame);
+			}
+		} else {
+			for (uint32 j = 0; j < _audioTracks.size(); j++) {
+				if (streamIndex == _audioTracks[j].index) {
+					_seekTable.audioChunks[j].push_back(i);
+					break;
+				}
+			}
+		}
+	}
+
+	debugC(6, kDebugLevelGVideo, "AVI seek table: %d frames, %d palette changes", _seekTable.frames.size(), _seekTable.palettes.size());
+}
+
 byte AVIDecoder::getStreamIndex(uint32 tag) {
 	char string[3];
 	WRITE_BE_UINT16(string, tag >> 16);
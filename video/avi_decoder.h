@@ -328,6 +328,22 @@ protected:
 	void readOldIndex(uint32 size);
 	IndexEntries _indexEntries;
 
+	/**
+	 * Lookup table for seeking in the first video track, built from the
+	 * index on the first seek so later seeks don't rescan the whole index.
+	 * All values are positions in _indexEntries, except keyFrames which
+	 * holds the frame number of the closest keyframe at or before each frame.
+	 */
+	struct SeekTable {
+		Common::Array<uint32> frames;
+		Common::Array<uint32> keyFrames;
+		Common::Array<uint32> palettes;
+		Common::Array<Common::Array<uint32> > audioChunks;
+	};
+
+	SeekTable _seekTable;
+	void buildSeekTable();
+
 	Common::SeekableReadStream *_fileStream;
 	bool _decodedHeader;
 	bool _foundMovieList;
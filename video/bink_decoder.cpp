@@ -247,6 +247,7 @@ BinkDecoder::AudioInfo::~AudioInfo() {
 BinkDecoder::BinkVideoTrack::BinkVideoTrack(uint32 width, uint32 height, uint32 frameCount, const Common::Rational &frameRate, bool swapPlanes, bool hasAlpha, uint32 id) :
 		_frameCount(frameCount), _frameRate(frameRate), _swapPlanes(swapPlanes), _hasAlpha(hasAlpha), _id(id), _surface(nullptr) {
 	_curFrame = -1;
+	_convertPending = false;
 
 	for (int i = 0; i < 16; i++)
 		_huffman[i] = 0;
@@ -430,6 +431,7 @@ bool BinkDecoder::BinkVideoTrack::rewind() {
 	}
 
 	_curFrame = -1;
+	_convertPending = false;
 
 	// Re-initialize the video with solid green
 	memset(_curPlanes[0],   0, _yBlockWidth  * 8 * _yBlockHeight  * 8);
@@ -476,24 +478,53 @@ void BinkDecoder::BinkVideoTrack::decodePacket(VideoFrame &frame) {
 			break;
 	}
 
+	// And swap the planes with the reference planes
+	for (int i = 0; i < 4; i++)
+		SWAP(_curPlanes[i], _oldPlanes[i]);
+
+	// The conversion to RGB is done when the frame is requested, so that it
+	// is skipped for frames which are never shown (e.g. when seeking), and
+	// can be done straight into a surface provided by the caller
+	_convertPending = true;
+
+	_curFrame++;
+}
+
+const Graphics::Surface *BinkDecoder::BinkVideoTrack::decodeNextFrame() {
+	if (_convertPending) {
+		convertFrame(_surface);
+		_convertPending = false;
+	}
+
+	return _surface;
+}
+
+bool BinkDecoder::BinkVideoTrack::decodeNextFrameInto(Graphics::Surface &dst) {
+	if (!_convertPending || dst.format != _pixelFormat)
+		return false;
+
+	// The conversion works on the whole even-sized surface
+	if (dst.w < _surfaceWidth || dst.h < _surfaceHeight)
+		return false;
+
+	// _surface is left as is, it's only updated if the frame is requested again
+	convertFrame(&dst);
+	return true;
+}
+
+void BinkDecoder::BinkVideoTrack::convertFrame(Graphics::Surface *dst) {
 	// Convert the YUV data we have to our format
 	// The width used here is the surface-width, and not the video-width
 	// to allow for odd-sized videos.
 	if (_hasAlpha) {
-		assert(_curPlanes[0] && _curPlanes[1] && _curPlanes[2] && _curPlanes[3]);
-		YUVToRGBMan.convert420Alpha(_surface, Graphics::YUVToRGBManager::kScaleITU, _curPlanes[0], _curPlanes[1], _curPlanes[2], _curPlanes[3],
+		assert(_oldPlanes[0] && _oldPlanes[1] && _oldPlanes[2] && _oldPlanes[3]);
+		YUVToRGBMan.convert420Alpha(dst, Graphics::YUVToRGBManager::kScaleITU, _oldPlanes[0], _oldPlanes[1], _oldPlanes[2], _oldPlanes[3],
 				_surfaceWidth, _surfaceHeight, _yBlockWidth * 8, _uvBlockWidth * 8);
 	} else {
-		assert(_curPlanes[0] && _curPlanes[1] && _curPlanes[2]);
-		YUVToRGBMan.convert420(_surface, Graphics::YUVToRGBManager::kScaleITU, _curPlanes[0], _curPlanes[1], _curPlanes[2],
+		assert(_oldPlanes[0] && _oldPlanes[1] && _oldPlanes[2]);
+		YUVToRGBMan.convert420(dst, Graphics::YUVToRGBManager::kScaleITU, _oldPlanes[0], _oldPlanes[1], _oldPlanes[2],
 				_surfaceWidth, _surfaceHeight, _yBlockWidth * 8, _uvBlockWidth * 8);
 	}
-
-	// And swap the planes with the reference planes
-	for (int i = 0; i < 4; i++)
-		SWAP(_curPlanes[i], _oldPlanes[i]);
-
-	_curFrame++;
 }
 
 void BinkDecoder::BinkVideoTrack::decodePlane(VideoFrame &video, int planeIdx, bool isChroma) {
@@ -162,7 +162,8 @@ private:
 
 		int getCurFrame() const override { return _curFrame; }
 		int getFrameCount() const override { return _frameCount; }
-		const Graphics::Surface *decodeNextFrame() override { return _surface; }
+		const Graphics::Surface *decodeNextFrame() override;
+		bool decodeNextFrameInto(Graphics::Surface &dst) override;
 		bool isSeekable() const  override{ return true; }
 		bool seek(const Audio::Timestamp &time) override { return true; }
 		bool rewind() override;
@@ -256,6 +257,7 @@ private:
 		uint16 _height;
 		int _surfaceWidth; ///< The actual surface width
 		int _surfaceHeight; ///< The actual surface height
+		bool _convertPending; ///< Has the last decoded frame not been converted to _surface yet?
 
 		uint32 _id; ///< The BIK FourCC.
 
@@ -281,6 +283,9 @@ private:
 		byte *_curPlanes[4]; ///< The 4 color planes, YUVA, current frame.
 		byte *_oldPlanes[4]; ///< The 4 color planes, YUVA, last frame.
 
+		/** Convert the last decoded frame to RGB into the given surface. */
+		void convertFrame(Graphics::Surface *dst);
+
 		/** Initialize the bundles. */
 		void initBundles();
 		/** Deinitialize the bundles. */
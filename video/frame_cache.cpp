@@ -0,0 +1,234 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "video/frame_cache.h"
+
+#include "common/debug.h"
+#include "common/textconsole.h"
+
+#include "graphics/surface.h"
+
+namespace Common {
+DECLARE_SINGLETON(Video::FrameCache);
+}
+
+namespace Video {
+
+// Default amount of memory used for cached frames
+static const uint32 kDefaultMemoryBudget = 16 * 1024 * 1024;
+
+FrameCache::FrameCache() : _budget(kDefaultMemoryBudget), _usage(0), _hits(0), _misses(0) {
+}
+
+FrameCache::~FrameCache() {
+	clear();
+}
+
+void FrameCache::setMemoryBudget(uint32 budget) {
+	_budget = budget;
+
+	if (_usage > _budget)
+		evict(_usage - _budget);
+}
+
+bool FrameCache::isCacheable(uint64 videoSize) const {
+	// Leave room for a few videos to be cached at the same time
+	return videoSize != 0 && videoSize <= _budget / 4;
+}
+
+bool FrameCache::getFrame(const Common::String &videoId, uint32 frame, Graphics::Surface &surface) {
+	FrameMap::iterator it = _frames.find(FrameKey(videoId, frame));
+	if (it == _frames.end()) {
+		_misses++;
+		return false;
+	}
+
+	_hits++;
+	CachedFrame &cached = it->_value;
+
+	// Move the frame to the front of the LRU list
+	_lru.erase(cached.lruPos);
+	_lru.push_front(it->_key);
+	cached.lruPos = _lru.begin();
+
+	if (surface.w != cached.width || surface.h != cached.height || surface.format != cached.format) {
+		surface.free();
+		surface.create(cached.width, cached.height, cached.format);
+	}
+
+	if (cached.packed) {
+		unpackFrame(cached.data, cached.size, surface);
+	} else {
+		const uint32 lineSize = cached.width * cached.format.bytesPerPixel;
+		const byte *src = cached.data;
+		for (int y = 0; y < cached.height; y++) {
+			memcpy(surface.getBasePtr(0, y), src, lineSize);
+			src += lineSize;
+		}
+	}
+
+	return true;
+}
+
+bool FrameCache::addFrame(const Common::String &videoId, uint32 frame, const Graphics::Surface &surface) {
+	if (!surface.getPixels())
+		return false;
+
+	const uint32 lineSize = surface.w * surface.format.bytesPerPixel;
+	const uint32 rawSize = lineSize * surface.h;
+	if (rawSize > _budget)
+		return false;
+
+	FrameKey key(videoId, frame);
+	FrameMap::iterator it = _frames.find(key);
+	if (it != _frames.end())
+		removeFrame(it);
+
+	CachedFrame cached;
+	cached.width = surface.w;
+	cached.height = surface.h;
+	cached.format = surface.format;
+	cached.packed = false;
+	cached.data = nullptr;
+	cached.size = rawSize;
+
+	// Paletted frames tend to have long runs of the same color
+	if (surface.format.bytesPerPixel == 1) {
+		byte *packed = (byte *)malloc(rawSize + (surface.w / 128 + 1) * surface.h);
+		uint32 packedSize = packFrame(surface, packed);
+
+		if (packedSize < rawSize) {
+			cached.packed = true;
+			cached.size = packedSize;
+			cached.data = (byte *)realloc(packed, packedSize);
+		} else {
+			free(packed);
+		}
+	}
+
+	if (!cached.data) {
+		cached.data = (byte *)malloc(rawSize);
+		byte *dst = cached.data;
+		for (int y = 0; y < surface.h; y++) {
+			memcpy(dst, surface.getBasePtr(0, y), lineSize);
+			dst += lineSize;
+		}
+	}
+
+	if (_usage + cached.size > _budget)
+		evict(_usage + cached.size - _budget);
+
+	_lru.push_front(key);
+	cached.lruPos = _lru.begin();
+	_frames[key] = cached;
+	_usage += cached.size;
+
+	debugC(9, kDebugLevelGVideo, "Cached frame %d of video %s (%d bytes, %d bytes used)", frame, videoId.c_str(), cached.size, _usage);
+	return true;
+}
+
+void FrameCache::clear() {
+	for (FrameMap::iterator it = _frames.begin(); it != _frames.end(); ++it)
+		free(it->_value.data);
+
+	_frames.clear();
+	_lru.clear();
+	_usage = 0;
+}
+
+void FrameCache::evict(uint32 size) {
+	uint32 freed = 0;
+
+	while (freed < size && !_lru.empty()) {
+		FrameMap::iterator it = _frames.find(_lru.back());
+		assert(it != _frames.end());
+
+		freed += it->_value.size;
+		removeFrame(it);
+	}
+}
+
+void FrameCache::removeFrame(FrameMap::iterator it) {
+	_usage -= it->_value.size;
+	_lru.erase(it->_value.lruPos);
+	free(it->_value.data);
+	_frames.erase(it);
+}
+
+uint32 FrameCache::packFrame(const Graphics::Surface &surface, byte *dst) {
+	// PackBits encoding, one line at a time: a header byte n followed by
+	// either n + 1 literal bytes (n < 128) or one byte repeated 257 - n times
+	byte *start = dst;
+
+	for (int y = 0; y < surface.h; y++) {
+		const byte *src = (const byte *)surface.getBasePtr(0, y);
+		int x = 0;
+
+		while (x < surface.w) {
+			int run = 1;
+			while (x + run < surface.w && run < 128 && src[x + run] == src[x])
+				run++;
+
+			if (run > 1) {
+				*dst++ = 257 - run;
+				*dst++ = src[x];
+				x += run;
+				continue;
+			}
+
+			int literal = 1;
+			while (x + literal < surface.w && literal < 128 &&
+					(x + literal + 1 >= surface.w || src[x + literal] != src[x + literal + 1]))
+				literal++;
+
+			*dst++ = literal - 1;
+			memcpy(dst, src + x, literal);
+			dst += literal;
+			x += literal;
+		}
+	}
+
+	return dst - start;
+}
+
+void FrameCache::unpackFrame(const byte *src, uint32 size, Graphics::Surface &surface) {
+	const byte *end = src + size;
+
+	for (int y = 0; y < surface.h; y++) {
+		byte *dst = (byte *)surface.getBasePtr(0, y);
+		int x = 0;
+
+		while (x < surface.w && src < end) {
+			byte header = *src++;
+
+			if (header < 128) {
+				memcpy(dst + x, src, header + 1);
+				src += header + 1;
+				x += header + 1;
+			} else {
+				memset(dst + x, *src++, 257 - header);
+				x += 257 - header;
+			}
+		}
+	}
+}
+
+} // End of namespace Video
@@ -0,0 +1,140 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef VIDEO_FRAME_CACHE_H
+#define VIDEO_FRAME_CACHE_H
+
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/singleton.h"
+#include "common/str.h"
+
+#include "graphics/pixelformat.h"
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Video {
+
+/**
+ * A memory-budgeted cache of decoded video frames, shared by all decoders.
+ *
+ * Frames are identified by a string describing the video (built by the
+ * decoder from the file contents) and the frame number. When the budget
+ * is exceeded, the least recently used frames are dropped. Paletted
+ * frames are stored run-length encoded when that saves memory.
+ *
+ * This is meant for short videos that get played over and over, such as
+ * loops, so that replaying a frame costs a copy instead of a decode.
+ */
+class FrameCache : public Common::Singleton<FrameCache> {
+public:
+	FrameCache();
+	~FrameCache();
+
+	/**
+	 * Set the maximum amount of memory, in bytes, used by the cached frames.
+	 * Frames are discarded as needed to fit in the new budget.
+	 */
+	void setMemoryBudget(uint32 budget);
+	uint32 getMemoryBudget() const { return _budget; }
+	uint32 getMemoryUsage() const { return _usage; }
+
+	/**
+	 * Check whether a video with the given total decoded size is worth caching,
+	 * which is the case when all of its frames fit comfortably in the budget.
+	 */
+	bool isCacheable(uint64 videoSize) const;
+
+	/**
+	 * Copy a cached frame into the given surface, (re)allocating it if
+	 * it does not match the size and format of the frame.
+	 *
+	 * @return true if the frame was found in the cache
+	 */
+	bool getFrame(const Common::String &videoId, uint32 frame, Graphics::Surface &surface);
+
+	/**
+	 * Store a copy of a decoded frame.
+	 *
+	 * @return true if the frame was added to the cache
+	 */
+	bool addFrame(const Common::String &videoId, uint32 frame, const Graphics::Surface &surface);
+
+	/** Drop all cached frames. */
+	void clear();
+
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+
+	struct FrameKey {
+		Common::String videoId;
+		uint32 frame;
+
+		FrameKey() : frame(0) {}
+		FrameKey(const Common::String &videoId_, uint32 frame_) : videoId(videoId_), frame(frame_) {}
+
+		bool operator==(const FrameKey &key) const { return frame == key.frame && videoId == key.videoId; }
+	};
+
+	struct FrameKey_Hash {
+		uint operator()(const FrameKey &key) const { return Common::hashit(key.videoId.c_str()) ^ (key.frame * 2654435761U); }
+	};
+
+	typedef Common::List<FrameKey> LRUList;
+
+	struct CachedFrame {
+		uint16 width;
+		uint16 height;
+		Graphics::PixelFormat format;
+		bool packed;
+		byte *data;
+		uint32 size;
+		LRUList::iterator lruPos;
+	};
+
+	typedef Common::HashMap<FrameKey, CachedFrame, FrameKey_Hash> FrameMap;
+
+	FrameMap _frames;
+	LRUList _lru; // Most recently used frames first
+	uint32 _budget;
+	uint32 _usage;
+	uint32 _hits;
+	uint32 _misses;
+
+	void evict(uint32 size);
+	void removeFrame(FrameMap::iterator it);
+
+	static uint32 packFrame(const Graphics::Surface &surface, byte *dst);
+	static void unpackFrame(const byte *src, uint32 size, Graphics::Surface &surface);
+};
+
+/** Shortcut for accessing the video frame cache. */
+#define VideoFrameCache (::Video::FrameCache::instance())
+
+} // End of namespace Video
+
+#endif
@@ -8,6 +8,7 @@ MODULE_OBJS := \
 	coktel_decoder.o \
 	dxa_decoder.o \
 	flic_decoder.o \
+	frame_cache.o \
 	mpegps_decoder.o \
 	mve_decoder.o \
 	paco_decoder.o \
@@ -29,11 +29,14 @@
 
 #include "video/qt_decoder.h"
 #include "video/qt_data.h"
+#include "video/frame_cache.h"
 
 #include "audio/audiostream.h"
 
+#include "common/algorithm.h"
 #include "common/archive.h"
 #include "common/debug.h"
+#include "common/md5.h"
 #include "common/memstream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
@@ -70,11 +73,22 @@ bool QuickTimeDecoder::loadFile(const Common::Path &filename) {
 	if (!Common::QuickTimeParser::parseFile(filename))
 		return false;
 
+	// Checksum the start of the file, so that a different movie which
+	// reuses the name doesn't get our cached frames
+	int64 pos = _fd->pos();
+	_fd->seek(0);
+	_fileChecksum = Common::computeStreamMD5AsString(*_fd, 5000);
+	_fd->seek(pos);
+	_fileName = filename;
+
 	init();
 	return true;
 }
 
 bool QuickTimeDecoder::loadStream(Common::SeekableReadStream *stream) {
+	_fileName.clear();
+	_fileChecksum.clear();
+
 	if (!Common::QuickTimeParser::parseStream(stream))
 		return false;
 
@@ -86,6 +100,9 @@ void QuickTimeDecoder::close() {
 	VideoDecoder::close();
 	Common::QuickTimeParser::close();
 
+	_fileName.clear();
+	_fileChecksum.clear();
+
 	if (_scaledSurface) {
 		_scaledSurface->free();
 		delete _scaledSurface;
@@ -326,7 +343,7 @@ Audio::SeekableAudioStream *QuickTimeDecoder::AudioTrackHandler::getSeekableAudi
 	return _audioTrack;
 }
 
-QuickTimeDecoder::VideoTrackHandler::VideoTrackHandler(QuickTimeDecoder *decoder, Common::QuickTimeParser::Track *parent) : _decoder(decoder), _parent(parent) {
+QuickTimeDecoder::VideoTrackHandler::VideoTrackHandler(QuickTimeDecoder *decoder, Common::QuickTimeParser::Track *parent) : _decoder(decoder), _parent(parent), _hasFrameIndex(false), _cachedFrame(nullptr), _codecFrame(-1), _dithered(false) {
 	if (decoder->_enableEditListBoundsCheckQuirk) {
 		checkEditListBounds();
 	}
@@ -388,6 +405,11 @@ QuickTimeDecoder::VideoTrackHandler::~VideoTrackHandler() {
 		_scaledSurface->free();
 		delete _scaledSurface;
 	}
+
+	if (_cachedFrame) {
+		_cachedFrame->free();
+		delete _cachedFrame;
+	}
 }
 
 bool QuickTimeDecoder::VideoTrackHandler::endOfTrack() const {
@@ -498,6 +520,10 @@ bool QuickTimeDecoder::VideoTrackHandler::setOutputPixelFormat(const Graphics::P
 		success = success && desc->_videoCodec->setOutputPixelFormat(format);
 	}
 
+	// Frames decoded in another format can't be reused
+	if (_hasFrameIndex)
+		updateFrameCacheId();
+
 	return success;
 }
 
@@ -699,60 +725,105 @@ Common::Rational QuickTimeDecoder::VideoTrackHandler::getScaledHeight() const {
 	return Common::Rational(_parent->height) / _parent->scaleFactorY;
 }
 
-Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePacket(uint32 &descId) {
-	// First, we have to track down which chunk holds the sample and which sample in the chunk contains the frame we are looking for.
-	int32 totalSampleCount = 0;
-	int32 sampleInChunk = 0;
-	int32 actualChunk = -1;
+void QuickTimeDecoder::VideoTrackHandler::buildFrameIndex() {
+	// Track down which chunk holds each sample, and where in the chunk the sample is located
 	uint32 sampleToChunkIndex = 0;
 
 	for (uint32 i = 0; i < _parent->chunkCount; i++) {
 		if (sampleToChunkIndex < _parent->sampleToChunkCount && i >= _parent->sampleToChunk[sampleToChunkIndex].first)
 			sampleToChunkIndex++;
 
-		totalSampleCount += _parent->sampleToChunk[sampleToChunkIndex - 1].count;
+		if (sampleToChunkIndex == 0)
+			continue;
 
-		if (totalSampleCount > _curFrame) {
-			actualChunk = i;
-			descId = _parent->sampleToChunk[sampleToChunkIndex - 1].id;
-			sampleInChunk = _parent->sampleToChunk[sampleToChunkIndex - 1].count - totalSampleCount + _curFrame;
-			break;
+		const Common::QuickTimeParser::SampleToChunkEntry &chunk = _parent->sampleToChunk[sampleToChunkIndex - 1];
+		uint32 offset = _parent->chunkOffsets[i];
+
+		for (uint32 j = 0; j < chunk.count; j++) {
+			FrameIndexEntry entry;
+			entry.offset = offset;
+			entry.descId = chunk.id;
+
+			if (_parent->sampleSize != 0)
+				entry.size = _parent->sampleSize;
+			else if (_frameIndex.size() < _parent->sampleCount)
+				entry.size = _parent->sampleSizes[_frameIndex.size()];
+			else
+				entry.size = 0;
+
+			offset += entry.size;
+			_frameIndex.push_back(entry);
 		}
 	}
 
-	if (actualChunk < 0)
-		error("Could not find data for frame %d", _curFrame);
+	// Expand the time-to-sample table into per-frame durations
+	for (int32 i = 0; i < _parent->timeToSampleCount; i++)
+		for (int32 j = 0; j < _parent->timeToSample[i].count; j++)
+			_frameDurations.push_back(_parent->timeToSample[i].duration);
 
-	// Next seek to that frame
-	Common::SeekableReadStream *stream = _decoder->_fd;
-	stream->seek(_parent->chunkOffsets[actualChunk]);
+	_hasFrameIndex = true;
+	debugC(3, kDebugLevelGVideo, "QuickTime frame index: %d samples, %d durations", _frameIndex.size(), _frameDurations.size());
 
-	// Then, if the chunk holds more than one frame, seek to where the frame we want is located
-	for (int32 i = _curFrame - sampleInChunk; i < _curFrame; i++) {
-		if (_parent->sampleSize != 0)
-			stream->skip(_parent->sampleSize);
-		else
-			stream->skip(_parent->sampleSizes[i]);
-	}
+	updateFrameCacheId();
+}
+
+void QuickTimeDecoder::VideoTrackHandler::updateFrameCacheId() {
+	_frameCacheId.clear();
+
+	// Streams without a name can't be told apart from other movies.
+	// QTVR movies access their frames out of order, so leave them alone.
+	if (_decoder->_fileName.empty() || _dithered || _decoder->_qtvrType != QTVRType::OTHER || _frameIndex.empty())
+		return;
+
+	if (_parent->sampleDescs.empty() || !((VideoSampleDesc *)_parent->sampleDescs[0])->_videoCodec)
+		return;
+
+	Graphics::PixelFormat format = getPixelFormat();
+	uint64 videoSize = (uint64)_frameIndex.size() * _parent->width * _parent->height * format.bytesPerPixel;
+	if (!VideoFrameCache.isCacheable(videoSize))
+		return;
+
+	const Common::Array<Common::QuickTimeParser::Track *> &tracks = _decoder->Common::QuickTimeParser::_tracks;
+	uint32 trackIndex = 0;
+	while (trackIndex < tracks.size() && tracks[trackIndex] != _parent)
+		trackIndex++;
+
+	_frameCacheId = Common::String::format("qt-%s-%d-%s-%d-%s", _decoder->_fileName.toString().c_str(), trackIndex,
+	                                       _decoder->_fileChecksum.c_str(), (int)_decoder->_fd->size(), format.toString().c_str());
+	debugC(3, kDebugLevelGVideo, "QuickTime frame cache id: %s", _frameCacheId.c_str());
+}
+
+const Graphics::Surface *QuickTimeDecoder::VideoTrackHandler::decodeFramePacket(int32 frame) {
+	const FrameIndexEntry &index = _frameIndex[frame];
+	if (!index.descId || index.descId > _parent->sampleDescs.size())
+		return 0;
+
+	VideoSampleDesc *entry = (VideoSampleDesc *)_parent->sampleDescs[index.descId - 1];
+	if (!entry->_videoCodec)
+		return 0;
 
-	// Finally, read in the raw data for the frame
-	//debug("Frame Data[%d]: Offset = %d, Size = %d", _curFrame, stream->pos(), _parent->sampleSizes[_curFrame]);
+	// Seek to the frame and read in its raw data
+	//debug("Frame Data[%d]: Offset = %d, Size = %d", frame, index.offset, index.size);
+	Common::SeekableReadStream *stream = _decoder->_fd;
+	stream->seek(index.offset);
+
+	Common::SeekableReadStream *frameData = stream->readStream(index.size);
+	if (!frameData)
+		return 0;
 
-	if (_parent->sampleSize != 0)
-		return stream->readStream(_parent->sampleSize);
+	const Graphics::Surface *surface = entry->_videoCodec->decodeFrame(*frameData);
+	delete frameData;
 
-	return stream->readStream(_parent->sampleSizes[_curFrame]);
+	_codecFrame = frame;
+	return surface;
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::getCurFrameDuration() {
-	uint32 curFrameIndex = 0;
-	for (int32 i = 0; i < _parent->timeToSampleCount; i++) {
-		curFrameIndex += _parent->timeToSample[i].count;
-		if ((uint32)_curFrame < curFrameIndex) {
-			// Ok, now we have what duration this frame has.
-			return _parent->timeToSample[i].duration;
-		}
-	}
+	if (!_hasFrameIndex)
+		buildFrameIndex();
+
+	if (_curFrame >= 0 && (uint32)_curFrame < _frameDurations.size())
+		return _frameDurations[_curFrame];
 
 	// This should never occur
 	error("Cannot find duration for frame %d", _curFrame);
@@ -760,9 +831,13 @@ uint32 QuickTimeDecoder::VideoTrackHandler::getCurFrameDuration() {
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::findKeyFrame(uint32 frame) const {
-	for (int i = _parent->keyframeCount - 1; i >= 0; i--)
-		if (_parent->keyframes[i] <= frame)
-			return _parent->keyframes[i];
+	// The sync sample table is sorted, so find the last keyframe at or before the frame
+	const uint32 *keyframesBegin = _parent->keyframes;
+	const uint32 *keyframesEnd = keyframesBegin + _parent->keyframeCount;
+	const uint32 *keyframe = Common::upperBound(keyframesBegin, keyframesEnd, frame);
+
+	if (keyframe != keyframesBegin)
+		return *(keyframe - 1);
 
 	// If none found, we'll assume the requested frame is a key frame
 	return frame;
@@ -848,22 +923,21 @@ const Graphics::Surface *QuickTimeDecoder::VideoTrackHandler::bufferNextFrame()
 	if (_decoder->_qtvrType != QTVRType::OBJECT)
 		_curFrame++;
 
-	// Get the next packet
-	uint32 descId;
-	Common::SeekableReadStream *frameData = getNextFramePacket(descId);
+	if (!_hasFrameIndex)
+		buildFrameIndex();
 
-	if (!frameData || !descId || descId > _parent->sampleDescs.size()) {
-		delete frameData;
-		return 0;
-	}
+	if (_curFrame < 0 || (uint32)_curFrame >= _frameIndex.size())
+		error("Could not find data for frame %d", _curFrame);
 
 	// Find which video description entry we want
+	uint32 descId = _frameIndex[_curFrame].descId;
+	if (!descId || descId > _parent->sampleDescs.size())
+		return 0;
+
 	VideoSampleDesc *entry = (VideoSampleDesc *)_parent->sampleDescs[descId - 1];
 
-	if (!entry->_videoCodec) {
-		delete frameData;
+	if (!entry->_videoCodec)
 		return 0;
-	}
 
 	// Check if the video description has been updated
 	const byte *palette = entry->_palette.data();
@@ -879,8 +953,41 @@ const Graphics::Surface *QuickTimeDecoder::VideoTrackHandler::bufferNextFrame()
 		_dirtyPalette = false;
 	}
 
-	const Graphics::Surface *frame = entry->_videoCodec->decodeFrame(*frameData);
-	delete frameData;
+	// Replaying a cached frame only costs a copy. Codecs which carry their
+	// own palette are left out, since the palette isn't cached.
+	bool useCache = !_frameCacheId.empty() && !entry->_videoCodec->containsPalette();
+
+	// Catching the codec up after a cache hit replays the frames since the
+	// last keyframe, which only works if they all go to the same codec
+	int32 keyFrame = 0;
+	if (useCache) {
+		keyFrame = findKeyFrame(_curFrame);
+		for (int32 i = keyFrame; i < _curFrame; i++) {
+			if (_frameIndex[i].descId != descId) {
+				useCache = false;
+				break;
+			}
+		}
+	}
+
+	if (useCache) {
+		if (!_cachedFrame)
+			_cachedFrame = new Graphics::Surface();
+
+		if (VideoFrameCache.getFrame(_frameCacheId, _curFrame, *_cachedFrame))
+			return _cachedFrame;
+	}
+
+	// The codec builds on its previous frame, so if frames were taken from
+	// the cache in between, bring it up to date from the last keyframe
+	if (useCache && _codecFrame != _curFrame - 1) {
+		int32 startFrame = (_codecFrame >= keyFrame && _codecFrame < _curFrame) ? _codecFrame + 1 : keyFrame;
+
+		for (int32 i = startFrame; i < _curFrame; i++)
+			decodeFramePacket(i);
+	}
+
+	const Graphics::Surface *frame = decodeFramePacket(_curFrame);
 
 	// The codec palette takes priority over the container one
 	if (entry->_videoCodec->containsPalette()) {
@@ -888,6 +995,9 @@ const Graphics::Surface *QuickTimeDecoder::VideoTrackHandler::bufferNextFrame()
 		_curPalette = entry->_videoCodec->getPalette();
 	}
 
+	if (useCache && frame)
+		VideoFrameCache.addFrame(_frameCacheId, _curFrame, *frame);
+
 	return frame;
 }
 
@@ -955,6 +1065,10 @@ bool QuickTimeDecoder::VideoTrackHandler::canDither() const {
 void QuickTimeDecoder::VideoTrackHandler::setDither(const byte *palette) {
 	assert(canDither());
 
+	// Dithered output depends on the palette, so don't cache it
+	_dithered = true;
+	_frameCacheId.clear();
+
 	for (uint i = 0; i < _parent->sampleDescs.size(); i++) {
 		VideoSampleDesc *desc = (VideoSampleDesc *)_parent->sampleDescs[i];
 
@@ -250,6 +250,10 @@ private:
 
 	bool _enableEditListBoundsCheckQuirk;
 
+	// Identify a movie loaded through loadFile() in the shared frame cache
+	Common::Path _fileName;
+	Common::String _fileChecksum;
+
 	bool _cursorDirty;
 	Common::Point _cursorPos;
 
@@ -371,7 +375,27 @@ private:
 		mutable bool _dirtyPalette;
 		bool _reversed;
 
-		Common::SeekableReadStream *getNextFramePacket(uint32 &descId);
+		// Frame index, built on first use from the sample tables, so that
+		// locating a frame does not require walking all the chunks
+		struct FrameIndexEntry {
+			uint32 offset;
+			uint32 size;
+			uint32 descId;
+		};
+
+		Common::Array<FrameIndexEntry> _frameIndex;
+		Common::Array<uint32> _frameDurations; // media time
+		bool _hasFrameIndex;
+
+		// Decoded frames of short movies are kept in the shared frame cache
+		Common::String _frameCacheId;
+		Graphics::Surface *_cachedFrame;
+		int32 _codecFrame; // last frame fed to the codec
+		bool _dithered;
+
+		void buildFrameIndex();
+		void updateFrameCacheId();
+		const Graphics::Surface *decodeFramePacket(int32 frame);
 		uint32 getCurFrameDuration();            // media time
 		uint32 findKeyFrame(uint32 frame) const;
 		bool isEmptyEdit() const;
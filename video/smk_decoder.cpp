@@ -301,6 +301,7 @@ SmackerDecoder::SmackerDecoder() {
 	_firstFrameStart = 0;
 	_frameTypes = 0;
 	_frameSizes = 0;
+	_frameOffsets = 0;
 }
 
 SmackerDecoder::~SmackerDecoder() {
@@ -410,8 +411,11 @@ bool SmackerDecoder::loadStream(Common::SeekableReadStream *stream) {
 	_header.dummy = _fileStream->readUint32LE();
 
 	_frameSizes = new uint32[frameCount];
-	for (i = 0; i < frameCount; ++i)
+	_frameOffsets = new uint32[frameCount];
+	for (i = 0; i < frameCount; ++i) {
 		_frameSizes[i] = _fileStream->readUint32LE();
+		_frameOffsets[i] = (i == 0) ? 0 : _frameOffsets[i - 1] + (_frameSizes[i - 1] & ~3);
+	}
 
 	_frameTypes = new byte[frameCount];
 	for (i = 0; i < frameCount; ++i)
@@ -439,6 +443,9 @@ void SmackerDecoder::close() {
 
 	delete[] _frameSizes;
 	_frameSizes = 0;
+
+	delete[] _frameOffsets;
+	_frameOffsets = 0;
 }
 
 bool SmackerDecoder::rewind() {
@@ -464,26 +471,32 @@ const Graphics::Surface *SmackerDecoder::forceSeekToFrame(uint frame) {
 	if (seekFrame >= getFrameCount())
 		return nullptr;
 
+	// Bit 0 of the frame size marks a keyframe. If there is one closer
+	// to the requested frame, start decoding from there instead.
+	for (uint i = MIN<uint>(frame, getFrameCount() - 1); i > seekFrame; i--) {
+		if (_frameSizes[i] & 1) {
+			seekFrame = i;
+			break;
+		}
+	}
+
 	if (!rewind())
 		return nullptr;
 
 	stopAudio();
 	SmackerVideoTrack *videoTrack = (SmackerVideoTrack *)getTrack(0);
-	uint32 startPos = _fileStream->pos();
-	uint32 offset = 0;
 	for (uint32 i = 0; i < seekFrame; i++) {
 		videoTrack->increaseCurFrame();
 		// Frames with palette data contain palette entries which use
 		// the previous palette as their base. Therefore, we need to
 		// parse all palette entries up to the requested frame
 		if (_frameTypes[videoTrack->getCurFrame()] & 1) {
-			_fileStream->seek(startPos + offset, SEEK_SET);
+			_fileStream->seek(_firstFrameStart + _frameOffsets[i], SEEK_SET);
 			videoTrack->unpackPalette(_fileStream);
 		}
-		offset += _frameSizes[i] & ~3;
 	}
 
-	if (!_fileStream->seek(startPos + offset, SEEK_SET))
+	if (!_fileStream->seek(_firstFrameStart + _frameOffsets[seekFrame], SEEK_SET))
 		return nullptr;
 
 	const Graphics::Surface *surface = nullptr;
@@ -222,6 +222,9 @@ protected:
 
 private:
 	uint32 _firstFrameStart;
+
+	// Offset of each frame relative to the first frame, for seeking
+	uint32 *_frameOffsets;
 };
 
 } // End of namespace Video
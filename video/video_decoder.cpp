@@ -28,6 +28,9 @@
 #include "common/file.h"
 #include "common/system.h"
 
+#include "graphics/blit.h"
+#include "graphics/surface.h"
+
 namespace Video {
 
 VideoDecoder::VideoDecoder() {
@@ -47,6 +50,7 @@ VideoDecoder::VideoDecoder() {
 	_mainAudioTrack = 0;
 	_canSetDither = true;
 	_canSetDefaultFormat = true;
+	_frameOutput = nullptr;
 	_videoCodecAccuracy = Image::CodecAccuracy::Default;
 }
 
@@ -219,7 +223,11 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	if (!_nextVideoTrack)
 		return 0;
 
-	const Graphics::Surface *frame = _nextVideoTrack->decodeNextFrame();
+	const Graphics::Surface *frame;
+	if (_frameOutput && _nextVideoTrack->decodeNextFrameInto(*_frameOutput))
+		frame = _frameOutput;
+	else
+		frame = _nextVideoTrack->decodeNextFrame();
 
 	if (_nextVideoTrack->hasDirtyPalette()) {
 		_palette = _nextVideoTrack->getPalette();
@@ -232,6 +240,33 @@ const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	return frame;
 }
 
+bool VideoDecoder::decodeNextFrameInto(Graphics::Surface &dst) {
+	// Subclasses overriding decodeNextFrame() may still return a frame
+	// of their own, which gets copied below
+	_frameOutput = &dst;
+	const Graphics::Surface *frame = decodeNextFrame();
+	_frameOutput = nullptr;
+
+	if (!frame)
+		return false;
+
+	if (frame != &dst) {
+		if (dst.w < frame->w || dst.h < frame->h) {
+			warning("VideoDecoder: Frame of %dx%d does not fit into %dx%d", frame->w, frame->h, dst.w, dst.h);
+			return false;
+		}
+
+		if (dst.format == frame->format) {
+			dst.copyRectToSurface(*frame, 0, 0, Common::Rect(frame->w, frame->h));
+		} else if (!Graphics::crossBlit((byte *)dst.getPixels(), (const byte *)frame->getPixels(), dst.pitch, frame->pitch, frame->w, frame->h, dst.format, frame->format)) {
+			warning("VideoDecoder: Cannot convert frame from %s to %s", frame->format.toString().c_str(), dst.format.toString().c_str());
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool VideoDecoder::setReverse(bool reverse) {
 	// Can only reverse video-only videos
 	if (reverse && hasAudio())
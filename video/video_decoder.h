@@ -371,6 +371,24 @@ public:
 	 */
 	virtual const Graphics::Surface *decodeNextFrame();
 
+	/**
+	 * Decode the next frame into the given surface.
+	 *
+	 * This is meant to be used with a surface lent by the backend through
+	 * OSystem::lockScreenRect(), so that the frame does not have to be
+	 * copied to the screen afterwards. Video tracks supporting it write
+	 * the frame straight into the surface, the others are decoded as usual
+	 * and the frame is copied in.
+	 *
+	 * The surface must be at least as large as the video. Its pixel format
+	 * should match the one of the video, otherwise the frame is converted.
+	 *
+	 * @return true if a frame was written to the surface, false if there
+	 *         was none or it could not be copied in
+	 * @note When false is returned, the surface is left untouched
+	 */
+	bool decodeNextFrameInto(Graphics::Surface &dst);
+
 	/**
 	 * Set the video to decode frames in reverse.
 	 *
@@ -661,6 +679,16 @@ protected:
 		 */
 		virtual const Graphics::Surface *decodeNextFrame() = 0;
 
+		/**
+		 * Decode the next frame straight into the given surface, which has
+		 * at least the size of the track.
+		 *
+		 * By default, this is not supported and decodeNextFrame() is used.
+		 *
+		 * @return true if the frame was written to the surface
+		 */
+		virtual bool decodeNextFrameInto(Graphics::Surface &dst) { return false; }
+
 		/**
 		 * Get the palette currently in use by this track
 		 */
@@ -1029,6 +1057,9 @@ private:
 	bool _canSetDither;
 	bool _canSetDefaultFormat;
 
+	// Surface the next frame is decoded into, if any
+	Graphics::Surface *_frameOutput;
+
 protected:
 	// Internal helper functions
 	void stopAudio();